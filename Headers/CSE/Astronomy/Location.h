@@ -109,28 +109,55 @@ struct StellarSystem
 
 namespace SystemBuilder
 {
-    /// @brief 索引树类型定义
+    /// @brief 名称索引类型定义，物体的每个名称都映射到它在列表中的索引
     /// @ingroup Locations
-    using IndexTreeType = std::multimap<uint64, uint64>;
+    using NameIndexType = std::unordered_map<ustring, uint64>;
 
     /**
-     * @brief 对天体列表进行索引排序
+     * @struct   ChildTableType
+     * @ingroup  Locations
+     * @brief    压缩存储的子节点表
+     * @details  第i个物体的子节点索引为 Children[Offsets[i]] 到 Children[Offsets[i + 1] - 1]，
+     *           所有物体的子节点存储在同一个连续数组中，不再为每个节点单独分配数组。
+     */
+    struct ChildTableType
+    {
+        std::vector<uint64> Offsets;  ///< 各物体子节点在Children中的起始位置，长度为物体数+1
+        std::vector<uint64> Children; ///< 子节点索引
+        std::vector<uint64> Roots;    ///< 没有父体（或父体不在列表中）的物体索引
+    };
+
+    /**
+     * @brief 为天体列表建立名称索引
      * @ingroup Locations
      * @param[in] List 天体对象列表
-     * @param[out] Barycenter 质心索引指针
-     * @return 排序后的索引树
+     * @return 名称到索引的哈希表
+     * @details 同名物体以列表中靠前的为准。
      */
-    IndexTreeType __Sort_Indices(std::vector<Object> List, uint64* Barycenter);
+    NameIndexType __Hash_Indices(const std::vector<Object>& List);
 
     /**
-     * @brief 广度优先构建行星系统
+     * @brief 根据名称索引解析每个物体的父体并生成子节点表
      * @ingroup Locations
      * @param[in] List 天体对象列表
-     * @param[in] Indices 索引树
-     * @param[in] Barycenter 质心索引
+     * @param[in] Names 名称索引
+     * @return 子节点表
+     * @details 对每个物体只做一次哈希查找，之后用计数排序生成压缩存储的子节点表，整体复杂度为O(n)。
+     *          子节点保持它们在列表中的先后顺序。
+     */
+    ChildTableType __Make_Child_Table(const std::vector<Object>& List, const NameIndexType& Names);
+
+    /**
+     * @brief 深度优先构建以指定物体为根的行星系统
+     * @ingroup Locations
+     * @param[in] List 天体对象列表
+     * @param[in] Table 子节点表
+     * @param[in] Root 根物体索引
      * @return 构建完成的系统根指针
+     * @details 使用显式栈迭代而非递归，深层嵌套的系统不会导致栈溢出。
      */
-    std::shared_ptr<StellarSystem> __BFS_BuildSystem(std::vector<Object> List, IndexTreeType Indices, uint64 Barycenter);
+    std::shared_ptr<StellarSystem> __DFS_BuildSystem(const std::vector<Object>& List,
+        const ChildTableType& Table, uint64 Root);
 }
 
 /**
@@ -138,8 +165,125 @@ namespace SystemBuilder
  * @ingroup Locations
  * @param[in] List 物体数组
  * @return 系统根指针
+ * @details 根物体指没有父体或父体不在列表中的物体（见 ChildTableType::Roots），列表中必须恰好有一个根物体。
+ *          包含多个系统时请使用 MakeSystems。
+ * @throws std::logic_error 没有根物体（列表为空或父体关系成环）或有多个根物体时抛出，异常信息中包含根物体的数量
+ */
+std::shared_ptr<StellarSystem> MakeSystem(const std::vector<Object>& List);
+
+/**
+ * @brief 从一组物体重建所有行星系统
+ * @ingroup Locations
+ * @param[in] List 物体数组，可以包含任意多个互不相关的系统
+ * @param[in] Threads 工作线程数，为0时自动选择
+ * @return 各系统的根指针，顺序与根物体在列表中的顺序相同
+ * @details 名称索引和子节点表只构建一次，之后各个根的系统树相互独立，按根分配给各个线程并行构建。
+ */
+std::vector<std::shared_ptr<StellarSystem>> MakeSystems(const std::vector<Object>& List, uint64 Threads = 0);
+
+/**
+ * @class    FlatStellarSystem
+ * @ingroup  Locations
+ * @brief    扁平存储的行星系统
+ * @details  StellarSystem 的不可变替代表示。所有节点按先序遍历的顺序存放在一个数组中，物体存放在另一个连续数组中，
+ *           节点之间通过索引而非智能指针相连。由于先序排列下任意子树都是数组中的一段连续区间，
+ *           遍历整个系统或某个子系统只需要线性扫描，不需要追踪指针，也不涉及引用计数。
  */
-std::shared_ptr<StellarSystem> MakeSystem(std::vector<Object> List);
+class FlatStellarSystem
+{
+public:
+    /// @brief 表示空索引的值
+    static constexpr uint64 NoIndex = uint64(-1);
+
+    /**
+     * @brief 树节点
+     */
+    struct NodeType
+    {
+        uint64 ObjectIndex;  ///< 物体在物体数组中的索引
+        uint64 Parent;       ///< 父节点索引，根节点为NoIndex
+        uint64 FirstChild;   ///< 第一个子节点索引，叶节点为NoIndex
+        uint64 NextSibling;  ///< 下一个兄弟节点索引，没有时为NoIndex
+        uint64 SubtreeEnd;   ///< 子树结束位置，子树占据节点数组的[自身索引, SubtreeEnd)
+        uint64 Depth;        ///< 节点深度，根节点为0
+    };
+
+    using DFSIterator = std::vector<NodeType>::const_iterator; ///< 深度优先（先序）遍历迭代器
+
+protected:
+    std::vector<Object>   Objects;   ///< 物体数组
+    std::vector<NodeType> Nodes;     ///< 按先序排列的节点数组
+    std::vector<uint64>   BFSOrder;  ///< 广度优先遍历顺序的节点索引，构造时生成
+
+public:
+    /**
+     * @brief 从树形的行星系统转换
+     * @param[in] Root 系统根节点
+     */
+    explicit FlatStellarSystem(const StellarSystem& Root);
+
+    /**
+     * @brief 直接从物体列表和子节点表构建，不经过树形结构
+     * @param[in] List 天体对象列表
+     * @param[in] Table 子节点表
+     * @param[in] Root 根物体索引
+     */
+    FlatStellarSystem(const std::vector<Object>& List,
+        const SystemBuilder::ChildTableType& Table, uint64 Root);
+
+    /**
+     * @brief 获取节点数量
+     */
+    uint64 Size()const;
+
+    /**
+     * @brief 获取节点
+     * @param[in] Index 节点索引
+     */
+    const NodeType& operator[](uint64 Index)const;
+
+    /**
+     * @brief 获取节点对应的物体
+     * @param[in] Index 节点索引
+     */
+    const Object& GetObject(uint64 Index)const;
+
+    /**
+     * @brief 获取物体数组
+     */
+    const std::vector<Object>& GetObjects()const;
+
+    /// @brief 先序遍历的起始迭代器
+    DFSIterator begin()const;
+    /// @brief 先序遍历的结束迭代器
+    DFSIterator end()const;
+
+    /**
+     * @brief 获取子树的节点区间
+     * @param[in] Index 子树根节点索引
+     * @return 按先序排列的子树节点，第一个元素为子树根节点
+     */
+    std::span<const NodeType> Subtree(uint64 Index)const;
+
+    /**
+     * @brief 获取广度优先遍历顺序
+     * @return 按广度优先顺序排列的节点索引
+     */
+    std::span<const uint64> BFS()const;
+
+    /**
+     * @brief 查找物体所在的节点
+     * @param[in] Name 物体名称
+     * @return 节点索引，找不到时为NoIndex
+     */
+    uint64 Find(const ustring& Name)const;
+
+    /**
+     * @brief 转换回树形的行星系统
+     * @return 系统根指针
+     */
+    std::shared_ptr<StellarSystem> ToTree()const;
+};
 
 /**
  * @struct __Flux_Type  
@@ -157,6 +301,101 @@ struct __Flux_Type
 /// @ingroup Locations
 extern const __Flux_Type __Photometric_Wavelengths_Table[9];  
 
+/**
+ * @class    CatalogPhotometry
+ * @ingroup  Locations
+ * @brief    天体目录的批量测光计算
+ * @details  每个天体的视星等原本存放在各自的 std::map 中，从新的观测位置重新计算视星等时，大部分时间花在了查找映射和逐个调用上。
+ *           此类把所有天体的星等按波段展开为稠密数组：波段的顺序与 __Photometric_Wavelengths_Table 相同，
+ *           同一波段所有天体的数据连续存放，缺失的数据以NaN填充。
+ *
+ * 载入时根据目录中的视星等、距离和目录所用的消光换算为绝对星等并只保存绝对星等，之后每次更换观测位置只需计算：
+ * \f[
+ * m_\lambda = M_\lambda + 5\log_{10}\frac{d}{10\text{pc}} + \frac{A_\lambda}{A_V}a_V d
+ * \f]
+ * 其中 \f$ a_V \f$ 为单位距离的V波段消光（星等/秒差距），\f$ A_\lambda/A_V \f$ 按Cardelli等(1989)[1]的消光曲线
+ * 在各波段的有效波长处取值，每个波段只计算一次。距离模数对所有波段相同，每个天体只计算一次。
+ * 整个计算按天体分块分配给各个线程。
+ *
+ * 载入时使用同一公式反算，消光取构造函数传入的值，因此在目录自身的位置（原点）以相同的消光调用 Recompute 会得到与输入相同的视星等。
+ *
+ * @par 参考文献
+ * [1] Cardelli J A, Clayton G C, Mathis J S. The Relationship between Infrared, Optical, and Ultraviolet Extinction[J]. The Astrophysical Journal, 1989, 345: 245-256.<br>
+ */
+class CatalogPhotometry
+{
+public:
+    /// @brief 波段数量
+    static constexpr uint64 BandCount = 9;
+
+protected:
+    uint64               Count = 0;          ///< 天体数量
+    std::vector<vec3>    Positions;          ///< 天体直角坐标 (秒差距)
+    std::vector<float64> AbsoluteMagnitudes; ///< 绝对星等，按波段分块存放
+    std::vector<float64> ApparentMagnitudes; ///< 最近一次计算的视星等，按波段分块存放
+    std::array<float64, BandCount> ExtinctionRatios; ///< 各波段的A_λ/A_V
+
+public:
+    /**
+     * @brief 获取波段字母对应的波段索引
+     * @param[in] PhotometricLetter 测光系统字母标识
+     * @return 波段索引，不存在时为-1
+     */
+    static int64 BandIndex(char PhotometricLetter);
+
+    /**
+     * @brief 从天体目录载入星等数据
+     * @param[in] Catalog 天体目录，视星等以目录中的距离为准
+     * @param[in] ExtinctionPerParsec 目录中的视星等所含的单位距离V波段消光 (星等/秒差距)，载入时据此去红化，默认为0即视星等不含消光
+     * @param[in] Threads 工作线程数，为0时自动选择
+     * @details 绝对星等按 \f$ M_\lambda = m_\lambda - 5\log_{10}\frac{d}{10\text{pc}} - \frac{A_\lambda}{A_V}a_V d \f$ 计算。
+     */
+    explicit CatalogPhotometry(const std::vector<Location>& Catalog, float64 ExtinctionPerParsec = 0, uint64 Threads = 0);
+
+    /**
+     * @brief 获取天体数量
+     */
+    uint64 Size()const;
+
+    /**
+     * @brief 从新的观测位置重新计算所有天体的视星等
+     * @param[in] ObserverPos 观测者的直角坐标 (秒差距)，坐标系与 PolarToXYZ 相同
+     * @param[in] ExtinctionPerParsec 单位距离的V波段消光 (星等/秒差距)，默认为0即不考虑消光
+     * @param[in] Threads 工作线程数，为0时自动选择
+     */
+    void Recompute(vec3 ObserverPos, float64 ExtinctionPerParsec = 0, uint64 Threads = 0);
+
+    /**
+     * @brief 获取某一波段所有天体的视星等
+     * @param[in] Band 波段索引
+     * @return 视星等数组，长度为天体数量
+     */
+    std::span<const float64> ApparentMagnitude(uint64 Band)const;
+
+    /**
+     * @brief 获取某一波段所有天体的绝对星等
+     * @param[in] Band 波段索引
+     * @return 绝对星等数组，长度为天体数量
+     */
+    std::span<const float64> AbsoluteMagnitude(uint64 Band)const;
+
+    /**
+     * @brief 计算某一波段所有天体的相对流量
+     * @param[in] Band 波段索引
+     * @param[out] Out 输出数组，长度为天体数量
+     * @details \f$ F/F_0 = 10^{-0.4m} \f$，使用 exp 的向量化版本计算。
+     */
+    void Flux(uint64 Band, float64* Out)const;
+
+    /**
+     * @brief 将重新计算的视星等写回天体目录
+     * @param[in,out] Catalog 天体目录，长度必须与载入时相同
+     * @details 只写入原本存在数据的波段，不会为天体添加新的波段。
+     * @throws std::logic_error 长度不一致时抛出
+     */
+    void WriteBack(std::vector<Location>& Catalog)const;
+};
+
 /**
  * @class  StarBarycenter
  * @ingroup Locations
@@ -281,6 +520,258 @@ void NormalizeCoord(Angle& RA, Angle& Dec);
  */
 void NormalizeCoord(Sexagesimal& RA, Sexagesimal& Dec);
 
+/**
+ * @defgroup SkyCoordBatch 批量坐标转换
+ * @ingroup  Locations
+ * @brief    天体目录坐标的批量转换
+ * @details
+ * Sexagesimal 是紧凑排列的结构体（13字节），其中的秒数字段不满足8字节对齐，逐个转换时每次都是非对齐访问且无法向量化。
+ * 以下函数按8个元素一组处理：先把一组Sexagesimal的各字段逐个读入对齐的临时数组，再对临时数组做向量化的浮点运算，
+ * 反方向转换同理。所有函数的输入和输出数组均由调用方分配，函数本身不分配内存。
+ * @{
+ */
+
+/**
+ * @class    SkyCoordColumns
+ * @brief    解码后的天体坐标列
+ * @details  把目录中的赤经、赤纬和距离分别解码为十进制数后按列存放，每列的起始地址按64字节对齐，
+ *           可以直接交给批量转换函数和空间索引使用，不必每次都从Sexagesimal重新解码。
+ */
+class SkyCoordColumns
+{
+protected:
+    uint64               Count = 0;   ///< 元素数量
+    uint64               Stride = 0;  ///< 每列占用的元素数（向上对齐到8的倍数）
+    std::vector<float64> Storage;     ///< 三列数据的存储空间，额外多分配用于对齐的部分
+
+public:
+    SkyCoordColumns() = default;
+
+    /**
+     * @brief 构造指定长度的坐标列
+     * @param[in] Size 元素数量
+     */
+    explicit SkyCoordColumns(uint64 Size);
+
+    /// @brief 获取元素数量
+    uint64 Size()const;
+
+    float64* RA();                ///< 赤经列 (角度)
+    const float64* RA()const;     ///< 赤经列 (角度)
+    float64* Dec();               ///< 赤纬列 (角度)
+    const float64* Dec()const;    ///< 赤纬列 (角度)
+    float64* Dist();              ///< 距离列 (秒差距)
+    const float64* Dist()const;   ///< 距离列 (秒差距)
+};
+
+/**
+ * @brief 批量将六十进制角度转换为十进制角度
+ * @param[in] In 六十进制角度数组
+ * @param[out] Out 十进制角度数组
+ * @param[in] Count 数组长度
+ * @see Sexagesimal::operator float64()
+ */
+void __cdecl SexagesimalToDegrees(const Sexagesimal* In, float64* Out, uint64 Count);
+
+/**
+ * @brief 批量将十进制角度转换为六十进制角度
+ * @param[in] In 十进制角度数组
+ * @param[out] Out 六十进制角度数组
+ * @param[in] Count 数组长度
+ * @see Sexagesimal::Sexagesimal(Angle)
+ */
+void __cdecl DegreesToSexagesimal(const float64* In, Sexagesimal* Out, uint64 Count);
+
+/**
+ * @brief 批量将24小时制的赤经转换为十进制角度
+ * @param[in] In 24小时制赤经数组（时、分、秒分别存放在Degrees、Minutes、Seconds中）
+ * @param[out] Out 十进制角度数组
+ * @param[in] Count 数组长度
+ * @see Convert24To360
+ */
+void __cdecl HoursToDegrees(const Sexagesimal* In, float64* Out, uint64 Count);
+
+/**
+ * @brief 批量将十进制角度转换为24小时制的赤经
+ * @param[in] In 十进制角度数组
+ * @param[out] Out 24小时制赤经数组
+ * @param[in] Count 数组长度
+ * @see Convert360To24
+ */
+void __cdecl DegreesToHours(const float64* In, Sexagesimal* Out, uint64 Count);
+
+/**
+ * @brief 批量归一化赤经赤纬坐标（浮点角度制）
+ * @param[in,out] RA 赤经数组
+ * @param[in,out] Dec 赤纬数组
+ * @param[in] Count 数组长度
+ * @see NormalizeCoord(float64&, float64&)
+ */
+void __cdecl NormalizeCoord(float64* RA, float64* Dec, uint64 Count);
+
+/**
+ * @brief 批量将天球坐标转换为直角坐标
+ * @param[in] RA 赤经数组 (角度)
+ * @param[in] Dec 赤纬数组 (角度)
+ * @param[in] Dist 距离数组，为空指针时输出单位向量
+ * @param[out] Out 直角坐标数组
+ * @param[in] Count 数组长度
+ * @note 坐标系与 PolarToXYZ 相同。
+ */
+void __cdecl SkyToXYZ(const float64* RA, const float64* Dec, const float64* Dist,
+    vec3* Out, uint64 Count);
+
+/**
+ * @brief 批量将直角坐标转换为天球坐标
+ * @param[in] In 直角坐标数组
+ * @param[out] RA 赤经数组 (角度，范围0°~360°)
+ * @param[out] Dec 赤纬数组 (角度)
+ * @param[out] Dist 距离数组，可以为空指针
+ * @param[in] Count 数组长度
+ * @note 坐标系与 XYZToPolar 相同，但赤经已归一化到[0, 360)。
+ */
+void __cdecl XYZToSky(const vec3* In, float64* RA, float64* Dec, float64* Dist, uint64 Count);
+
+/**
+ * @brief 解码天体目录的坐标
+ * @param[in] Catalog 天体目录
+ * @param[in] Threads 工作线程数，为0时自动选择
+ * @return 解码后的坐标列
+ */
+SkyCoordColumns DecodeCatalog(const std::vector<Location>& Catalog, uint64 Threads = 0);
+
+/**
+ * @brief 将坐标列写回天体目录
+ * @param[in] Columns 坐标列，长度必须与目录相同
+ * @param[in,out] Catalog 天体目录
+ * @param[in] Threads 工作线程数，为0时自动选择
+ * @throws std::logic_error 长度不一致时抛出
+ */
+void EncodeCatalog(const SkyCoordColumns& Columns, std::vector<Location>& Catalog, uint64 Threads = 0);
+
+/**@}*/
+
+/**
+ * @class    CatalogSpatialIndex
+ * @ingroup  Locations
+ * @brief    天体目录的空间索引
+ * @details  用于在大型目录中快速查找某一方向附近或某一点附近的天体，避免对每个条目做角度转换和全表扫描。索引由两部分组成：
+ * 1. 天球方向索引：使用HEALPix NESTED方案[1]将天球划分为 \f$ 12 \cdot 4^{k} \f$ 个等面积像素，每个像素中的天体索引压缩存储在同一个连续数组中。
+ *    锥形查询时先求出与查询圆相交的像素，再只对这些像素中的天体做精确的角距检验；
+ * 2. 三维位置索引：对 PolarToXYZ 得到的直角坐标（单位：秒差距）建立平衡k-d树，节点隐式存放在一个排列数组中，
+ *    用于长方体范围查询和k近邻查询。
+ *
+ * 构建时天体坐标的解码、像素计算和k-d树的上层划分按线程分块并行进行。索引建立后是只读的，可以被多个线程同时查询。
+ * 查询结果均为天体在原目录中的索引。
+ *
+ * @note 没有距离数据的天体(Dist无效)只参与锥形查询，不进入k-d树。
+ *
+ * @par 参考文献
+ * [1] Gorski K M, Hivon E, Banday A J, et al. HEALPix: A Framework for High-Resolution Discretization and Fast Analysis of Data Distributed on the Sphere[J]. The Astrophysical Journal, 2005, 622(2): 759-771.<br>
+ */
+class CatalogSpatialIndex
+{
+protected:
+    uint64               HEALPixOrder;   ///< HEALPix阶数k，Nside = 2^k
+    std::vector<vec3>    Directions;     ///< 天体方向的单位向量
+    std::vector<vec3>    Positions;      ///< 天体直角坐标 (秒差距)
+    std::vector<uint64>  PixelOffsets;   ///< 各像素中天体在PixelEntries中的起始位置
+    std::vector<uint64>  PixelEntries;   ///< 按像素排列的天体索引
+    std::vector<uint64>  KDTree;         ///< 隐式k-d树，按中位数划分后的天体索引排列
+    std::vector<uint8_t> KDAxis;         ///< 各子树的划分轴
+
+    /**
+     * @brief 计算方向所在的HEALPix NESTED像素编号
+     * @param[in] Dir 单位方向向量
+     */
+    uint64 __Pixel_Of(vec3 Dir)const;
+
+    /**
+     * @brief 求与查询圆相交的所有像素
+     * @param[in] Center 查询圆中心的单位向量
+     * @param[in] Radius 查询圆半径
+     * @return 像素编号列表（可能包含少量实际不相交的像素）
+     * @details 从第0阶的12个基础像素开始逐层细分，丢弃包围圆与查询圆不相交的像素。
+     */
+    std::vector<uint64> __Query_Disc_Pixels(vec3 Center, Angle Radius)const;
+
+    /**
+     * @brief 递归构建k-d树
+     * @param[in] First 子树起始位置
+     * @param[in] Last 子树结束位置
+     * @param[in] Threads 可用线程数，大于1时左右子树并行构建
+     * @details 每层沿包围盒最长的轴用 std::nth_element 取中位数划分。
+     */
+    void __Build_KD_Tree(uint64 First, uint64 Last, uint64 Threads);
+
+    /**
+     * @brief 从解码后的坐标建立索引
+     */
+    void __Build(uint64 Threads);
+
+public:
+    /**
+     * @brief 从天体目录建立索引
+     * @param[in] Catalog 天体目录
+     * @param[in] HEALPixOrder HEALPix阶数，默认为6（像素边长约0.9°）
+     * @param[in] Threads 工作线程数，为0时自动选择
+     */
+    explicit CatalogSpatialIndex(const std::vector<Location>& Catalog,
+        uint64 HEALPixOrder = 6, uint64 Threads = 0);
+
+    /**
+     * @brief 从十进制坐标数组建立索引
+     * @param[in] RA 赤经数组 (角度)
+     * @param[in] Dec 赤纬数组 (角度)
+     * @param[in] Dist 距离数组 (秒差距)
+     * @param[in] HEALPixOrder HEALPix阶数，默认为6
+     * @param[in] Threads 工作线程数，为0时自动选择
+     * @details 适用于StarBarycenter、Galaxy等派生类目录，或已经解码为十进制的坐标。
+     */
+    CatalogSpatialIndex(const std::vector<float64>& RA, const std::vector<float64>& Dec,
+        const std::vector<float64>& Dist, uint64 HEALPixOrder = 6, uint64 Threads = 0);
+
+    /**
+     * @brief 从解码后的坐标列建立索引
+     * @param[in] Columns 坐标列
+     * @param[in] HEALPixOrder HEALPix阶数，默认为6
+     * @param[in] Threads 工作线程数，为0时自动选择
+     */
+    explicit CatalogSpatialIndex(const SkyCoordColumns& Columns,
+        uint64 HEALPixOrder = 6, uint64 Threads = 0);
+
+    /**
+     * @brief 获取索引中的天体数量
+     */
+    uint64 Size()const;
+
+    /**
+     * @brief 锥形查询
+     * @param[in] RA 查询中心赤经
+     * @param[in] Dec 查询中心赤纬
+     * @param[in] Radius 查询半径
+     * @return 角距不超过查询半径的天体索引，按索引升序排列
+     */
+    std::vector<uint64> Cone(Angle RA, Angle Dec, Angle Radius)const;
+
+    /**
+     * @brief 长方体范围查询
+     * @param[in] Min 长方体最小角的直角坐标 (秒差距)
+     * @param[in] Max 长方体最大角的直角坐标 (秒差距)
+     * @return 位于长方体内的天体索引，按索引升序排列
+     */
+    std::vector<uint64> Box(vec3 Min, vec3 Max)const;
+
+    /**
+     * @brief k近邻查询
+     * @param[in] Pos 查询点的直角坐标 (秒差距)
+     * @param[in] K 需要的天体数量
+     * @return 距离查询点最近的K个天体索引，按距离升序排列
+     * @details 使用容量为K的最大堆维护候选集，当子树包围盒到查询点的距离大于堆顶距离时剪枝。
+     */
+    std::vector<uint64> Nearest(vec3 Pos, uint64 K)const;
+};
+
 /**
  * @brief 从键值对获取位置信息
  * @ingroup Locations
@@ -193,6 +193,108 @@ public:
     operator ustring() const;
 }StellarClassification;
 
+/**
+ * @brief 恒星光谱分类缓存
+ * @ingroup StellarClass
+ * @details
+ * 星表中不同的光谱型字符串通常只有几千种，却会在数百万颗恒星中重复出现，而每次调用 CreateFromString 都要完整地做一遍类型检测和解析。
+ * 此类以原始字符串为键缓存解析结果的指针，相同的字符串只解析一次。由于 StellarClassData 的接口只提供只读访问，
+ * 同一个结果可以被多颗恒星和多个线程共享。
+ *
+ * 为了减少多线程下的锁竞争，缓存按字符串的哈希值分为 ShardCount 个分片，每个分片有独立的读写锁，命中时只需要读锁。
+ * 每个分片的容量有上限，满了之后按CLOCK（二次机会）算法淘汰：每个条目有一个访问标志，命中时置位，
+ * 淘汰时时钟指针扫过的条目若已置位则清除标志并跳过，否则将其淘汰。这样常用的光谱型会一直留在缓存中。
+ */
+class StellarClassificationCache
+{
+public:
+    using Pointer   = StellarClassification::Pointer;   ///< 解析结果指针类型
+    using StarTypes = StellarClassification::StarTypes; ///< 恒星类型
+
+    /// @brief 分片数量
+    static constexpr uint64 ShardCount = 64;
+
+    /**
+     * @brief 缓存统计信息
+     */
+    struct StatisticsType
+    {
+        uint64 Hits      = 0; ///< 命中次数
+        uint64 Misses    = 0; ///< 未命中次数
+        uint64 Evictions = 0; ///< 淘汰次数
+        uint64 Size      = 0; ///< 当前条目数
+    };
+
+protected:
+    /**
+     * @brief 缓存分片
+     */
+    struct ShardType
+    {
+        /**
+         * @brief 缓存条目
+         */
+        struct EntryType
+        {
+            ustring           Key;         ///< 原始字符串
+            Pointer           Value;       ///< 解析结果
+            std::atomic<bool> Referenced;  ///< CLOCK算法的访问标志
+        };
+
+        mutable std::shared_mutex               Mutex;       ///< 读写锁
+        std::unordered_map<ustring, uint64>     Index;       ///< 字符串到条目位置的映射
+        std::unique_ptr<EntryType[]>            Entries;     ///< 条目数组，构造时按分片容量分配
+        uint64                                  Count = 0;   ///< 已使用的条目数
+        uint64                                  ClockHand = 0; ///< 时钟指针
+        std::atomic<uint64>                     Hits = 0;      ///< 命中次数
+        std::atomic<uint64>                     Misses = 0;    ///< 未命中次数
+        std::atomic<uint64>                     Evictions = 0; ///< 淘汰次数
+    };
+
+    std::array<ShardType, ShardCount> Shards; ///< 分片
+    uint64 CapacityPerShard;                  ///< 每个分片的容量
+
+    /**
+     * @brief 根据字符串选择分片
+     */
+    ShardType& __Select_Shard(const ustring& Class);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param Capacity 缓存的总容量，平均分配到各个分片，默认65536
+     */
+    explicit StellarClassificationCache(uint64 Capacity = 65536);
+
+    /**
+     * @brief 获取字符串的解析结果，缓存中没有时解析并加入缓存
+     * @param Class 光谱分类字符串
+     * @param Type 恒星类型，默认为Auto（自动检测）
+     * @return 解析结果指针
+     * @note 恒星类型不为Auto时不经过缓存，直接解析。
+     */
+    Pointer Get(const ustring& Class, StarTypes Type = StellarClassification::Auto);
+
+    /**
+     * @brief 批量获取解析结果
+     * @param Classes 光谱分类字符串数组
+     * @param Threads 工作线程数，为0时自动选择
+     * @return 解析结果指针数组，与输入一一对应
+     */
+    std::vector<Pointer> Get(const std::vector<ustring>& Classes, uint64 Threads = 0);
+
+    /**
+     * @brief 清空缓存，统计信息同时清零
+     */
+    void Clear();
+
+    /**
+     * @brief 获取统计信息
+     * @return 所有分片统计信息的和
+     */
+    StatisticsType Statistics()const;
+};
+
 namespace StelCls {
 
 /**
@@ -887,6 +989,84 @@ protected:
      */
     static void LoadPecularitiesStage3(NormalStar* Output, ustring Source, ustring* Remain, ParserStateType* State);
 
+    /**
+     * @brief 编译后的光谱型主体解析器
+     * @details 原有的解析流程依次调用 ParserEventQueue 中的处理函数，每个处理函数都要用正则表达式匹配剩余字符串，
+     *          并按值传递新的剩余字符串，因此每个字符都会被复制和匹配多次。对于光谱型的主体部分，即光谱类型、碳型、次型、
+     *          光度级、子光度级，以及它们之间的范围符号和不确定符号，实际上构成一个正则语言，这里将其手工编译为确定有限状态自动机(DFA)：
+     *
+     * 1. 先用 CharClassTable 把每个字符映射到字符类，见 CharClass，非ASCII字符一律归入COther；
+     * 2. 再用 TransitionTable 按(当前状态, 字符类)查出下一个状态和需要执行的动作，动作只修改 ValueType::Details 中的字段和
+     *    UncertaintySymbols 标志位，不构造任何字符串；
+     * 3. 遇到无法转移的字符时停机，停机位置之后的部分（特殊谱线、化学元素和波段特征）交给原有的 LoadPecularities 系列函数处理。
+     *    对于绝大多数只有主体部分的光谱型（如G2V、K3III），这一步不会发生。
+     *
+     * 状态的划分与 ParserStateType 对应，括号和范围通过状态中的 POpMask 位表示，目的是使解析结果（包括不确定符号）与原有流程一致。
+     * 原有流程保留为 __Parse_Legacy，两者的结果在目录数据上不一致时以 __Parse_Legacy 为准，应视为自动机的缺陷。
+     */
+    struct CompiledParserType
+    {
+        /**
+         * @brief 字符类
+         */
+        enum CharClass : uint8_t
+        {
+            CSpec = 0,      ///< 光谱字母 O B A F G K M
+            CCarbon,        ///< 碳型和S型字母 C N S
+            CDigit,         ///< 数字
+            CDot,           ///< 小数点
+            CRomanI,        ///< 罗马数字 I
+            CRomanV,        ///< 罗马数字 V
+            CSubLum,        ///< 子光度级字母 a b
+            CUnderscore,    ///< 下划线，用于 _0 写法的特超巨星
+            CUncertain,     ///< 不确定符号 : ?
+            CPlusMinus,     ///< 加减号
+            CSlash,         ///< 斜杠
+            CLeftBracket,   ///< 左括号
+            CRightBracket,  ///< 右括号
+            CSpace,         ///< 空白
+            COther,         ///< 其他字符
+            CharClassCount
+        };
+
+        /// @brief 自动机的状态数量
+        static constexpr uint8_t StateCount = 24;
+
+        /// @brief 表示停机的状态
+        static constexpr uint8_t Halt = 0xFF;
+
+        /**
+         * @brief 状态转移表的表项
+         */
+        struct TransitionType
+        {
+            uint8_t Next;    ///< 下一个状态，Halt表示停机
+            uint8_t Action;  ///< 转移时执行的动作编号
+        };
+
+        /// @brief ASCII字符到字符类的映射表
+        static const std::array<CharClass, 128> CharClassTable;
+
+        /// @brief 状态转移表
+        static const TransitionType TransitionTable[StateCount][CharClassCount];
+    };
+
+    /**
+     * @brief 使用编译后的自动机解析光谱型主体
+     * @param[in] Source 光谱型字符串
+     * @param[out] Output 输出对象，写入Data、CData和FloatData
+     * @return 解析停止的位置，等于字符串长度表示已全部解析
+     * @details 只读取Source，不复制字符串也不分配内存。
+     */
+    static uint64 __DFA_Parse_Main(const ustring& Source, NormalStar* Output)noexcept;
+
+    /**
+     * @brief 使用原有的事件队列解析
+     * @param[in] StelClassString 恒星光谱类型字符串
+     * @return 解析结果智能指针
+     */
+    static std::shared_ptr<StellarClassData> __Parse_Legacy(ustring StelClassString);
+
     ustring ExportSpec() const;          ///< 导出光谱类型
     ustring ExportSub() const;           ///< 导出次型
     ustring ExportSpecSubRange() const;  ///< 导出光谱次型范围
@@ -908,9 +1088,23 @@ public:
      * @brief 解析函数
      * @param[in] StelClassString 恒星光谱类型字符串
      * @return 解析结果智能指针
+     * @details 先使用 __DFA_Parse_Main 解析主体部分，剩余部分再交给特殊谱线的处理函数。
      */
     static std::shared_ptr<StellarClassData> ParseFunc(ustring StelClassString);
 
+    /**
+     * @brief 不分配内存的解析函数
+     * @param[in] StelClassString 恒星光谱类型字符串
+     * @param[out] Main 主要数据
+     * @param[out] Float 浮动数据，不存在时光谱类型为0，可以为空指针
+     * @param[out] Carbon 碳型（如M3SIII中的S），不存在时置为空，可以为空指针
+     * @return 是否已全部解析，为false时说明字符串包含特殊谱线等主体以外的部分，
+     *         或者字符串含有碳型而Carbon为空指针，即输出参数无法容纳全部结果
+     * @details 只需要光谱类型、次型和光度级时使用，不构造NormalStar对象。
+     */
+    static bool ParseMain(const ustring& StelClassString, ValueType* Main, ValueType* Float = nullptr,
+        std::optional<CarbonType>* Carbon = nullptr)noexcept;
+
     /**
      * @brief 转换为字符串
      * @return 字符串表示
@@ -1333,6 +1527,193 @@ public:
     ustring UnanalyzedString() const override;
 };
 
+/**
+ * @brief 压缩编码的光谱型
+ * @ingroup StellarClass
+ * @details
+ * 把 NormalStar::ValueType::Details 的全部字段（包括各字段的不确定符号）和碳型压缩到一个64位整数中，用于大规模的统计和查表，
+ * 避免通过 StellarClassData 的虚函数和字符串访问各个字段。各字段的位布局如下（从低位到高位）：
+ * |位|字段|说明|
+ * |---|---|---|
+ * |0|Valid|主体字段有效，为0表示解析失败或空字符串|
+ * |1|HasFloat|存在浮动数据（如G2Ib-II中的II），浮动数据不编码，此位为1时HasExtra也为1，完整结果见溢出表|
+ * |2|HasExtra|存在主体以外的部分，完整结果见溢出表|
+ * |3-4|Carbon|碳型，0表示无，1~3分别为C、N、S|
+ * |5-8|保留|为0|
+ * |9-17|SLumU|子光度级的不确定符号|
+ * |18-26|LumU|光度级的不确定符号|
+ * |27-35|SubU|次型的不确定符号|
+ * |36-44|SpecU|光谱类型的不确定符号|
+ * |45-46|SLum|子光度级，0表示无|
+ * |47-49|Lum|光度级，0表示无|
+ * |50-60|Sub|次型(*100)，0x7FF表示无|
+ * |61-63|Spec|光谱类型，0表示无|
+ *
+ * 光谱类型和次型位于最高位，因此直接比较Code即按光谱类型、次型、光度级、子光度级的顺序排序，
+ * 即温度从高到低；不确定符号、碳型和标志位只在这些字段都相同时影响顺序。
+ */
+struct PackedStellarClass
+{
+    /// @brief 次型字段表示"无"的值
+    static constexpr uint16_t SubNpos = 0x7FF;
+
+    uint64 Code = 0; ///< 编码值
+
+    /**
+     * @brief 由光谱型数据编码
+     * @param Main 主要数据
+     * @param Carbon 碳型，不存在时为空
+     * @param HasFloat 是否存在浮动数据
+     * @param HasExtra 是否存在主体以外的部分
+     * @details 次型超过20.46时无法编码，此时设置HasExtra，完整结果由溢出表保存。
+     *          浮动数据同样不编码，HasFloat为真时总是同时设置HasExtra，使浮动数据可以从溢出表中取回。
+     */
+    static PackedStellarClass Encode(const NormalStar::ValueType& Main,
+        std::optional<NormalStar::CarbonType> Carbon = std::nullopt,
+        bool HasFloat = false, bool HasExtra = false)noexcept;
+
+    /**
+     * @brief 解码为光谱型数据
+     * @return 光谱型数据，只包含DetailedData
+     */
+    NormalStar::ValueType Decode()const noexcept;
+
+    /**
+     * @brief 解码碳型
+     * @return 碳型，不存在时为空
+     */
+    std::optional<NormalStar::CarbonType> Carbon()const noexcept;
+
+    bool Valid()const noexcept;         ///< 主体字段是否有效
+    bool HasFloat()const noexcept;      ///< 是否存在浮动数据
+    bool HasExtra()const noexcept;      ///< 是否存在主体以外的部分
+};
+
+/**
+ * @brief 批量分类的结果
+ * @ingroup StellarClass
+ */
+struct BulkClassificationResult
+{
+    /// @brief 各恒星的编码，与输入一一对应
+    std::vector<PackedStellarClass> Codes;
+
+    /// @brief 溢出表：HasExtra为真（包括所有HasFloat为真）的恒星的完整解析结果，按恒星索引升序排列
+    std::vector<std::pair<uint64, StellarClassification::Pointer>> Overflow;
+
+    /**
+     * @brief 在溢出表中查找恒星的完整解析结果
+     * @param Index 恒星索引
+     * @return 解析结果指针，不存在时为空
+     */
+    StellarClassification::Pointer Find(uint64 Index)const;
+};
+
+/**
+ * @brief 批量分类光谱型字符串
+ * @ingroup StellarClass
+ * @param Classes 光谱分类字符串数组
+ * @param Threads 工作线程数，为0时自动选择
+ * @param Cache 分类缓存，为空指针时不使用缓存
+ * @return 批量分类的结果
+ * @details 输入按块分配给各个线程。每个字符串先用 NormalStar::ParseMain 解析（包括浮动数据和碳型），完全解析成功且没有浮动数据时直接编码，
+ *          不构造任何对象；否则（包括存在浮动数据时）再通过缓存（或 StellarClassification::CreateFromString）获取完整结果，
+ *          编码其主光谱和碳型，设置HasExtra（存在浮动数据时同时设置HasFloat）并将指针放入溢出表。解析失败的字符串编码为0。各线程的溢出表最后按索引顺序合并。
+ */
+BulkClassificationResult ClassifyBulk(std::span<const ustring> Classes, uint64 Threads = 0,
+    StellarClassificationCache* Cache = nullptr);
+
+/**
+ * @brief 光谱型到物理参数的查找表
+ * @ingroup StellarClass
+ * @details
+ * 用于合成恒星时由光谱型快速得到有效温度、半径、质量和总光度。表的节点为每个光谱类型(O~M)在整数次型(0~10)上、
+ * 每个光度级（主序星到特超巨星）上的典型参数，按 \f$ (\text{Spec}, \text{Lum}, \text{Sub}) \f$ 的顺序稠密排列，
+ * 节点索引可以直接由 PackedStellarClass 的对应位计算得到，不需要任何查找。
+ *
+ * 非整数次型在相邻两个节点间插值，温度、半径、质量和总光度都先取对数再线性插值。缺失的次型按5处理，缺失的光度级按主序星处理，
+ * 子光度级a/b按相邻两个光度级的1/4和3/4处插值。浮动数据和不确定符号不参与计算。
+ *
+ * 内置的主序星数据取自Pecaut和Mamajek(2013)[1]的表格，巨星和超巨星的数据取自Straizys和Kuriliene(1981)[2]，
+ * 也可以从外部数据构造。
+ *
+ * @par 参考文献
+ * [1] Pecaut M J, Mamajek E E. Intrinsic Colors, Temperatures, and Bolometric Corrections of Pre-main-sequence Stars[J]. The Astrophysical Journal Supplement Series, 2013, 208(1): 9.<br>
+ * [2] Straizys V, Kuriliene G. Fundamental stellar parameters derived from the evolutionary tracks[J]. Astrophysics and Space Science, 1981, 80: 353-368.<br>
+ */
+class StellarParameterTable
+{
+public:
+    /**
+     * @brief 恒星物理参数
+     */
+    struct ParametersType
+    {
+        float64 Temperature = _NoDataDbl; ///< 有效温度（开氏度）
+        float64 Radius      = _NoDataDbl; ///< 半径（米）
+        float64 Mass        = _NoDataDbl; ///< 质量（千克）
+        float64 LumBol      = _NoDataDbl; ///< 总光度（瓦特）
+    };
+
+    static constexpr uint64 SpecCount = 7;   ///< 光谱类型数量
+    static constexpr uint64 LumCount  = 7;   ///< 光度级编码数量（含未使用的编码）
+    static constexpr uint64 SubCount  = 11;  ///< 每个光谱类型的整数次型节点数量
+    static constexpr uint64 TableSize = SpecCount * LumCount * SubCount; ///< 节点总数
+
+protected:
+    /// @brief 节点数组，存放各参数的自然对数，缺失的节点为NaN
+    std::array<ParametersType, TableSize> LogTable;
+
+    /**
+     * @brief 计算节点索引
+     * @param Spec 光谱类型编码(1~7)
+     * @param Lum 光度级编码(1~7)
+     * @param Sub 整数次型(0~10)
+     */
+    static constexpr uint64 __Node_Index(uint64 Spec, uint64 Lum, uint64 Sub)noexcept
+    {
+        return ((Spec - 1) * LumCount + (Lum - 1)) * SubCount + Sub;
+    }
+
+public:
+    /**
+     * @brief 使用内置数据构造
+     */
+    StellarParameterTable();
+
+    /**
+     * @brief 使用外部数据构造
+     * @param Nodes 节点数组，按 __Node_Index 的顺序排列，不存在的节点填入NaN
+     */
+    explicit StellarParameterTable(const std::array<ParametersType, TableSize>& Nodes);
+
+    /**
+     * @brief 查表得到物理参数
+     * @param Code 压缩编码的光谱型
+     * @return 物理参数，光谱型无效或节点缺失时各字段为NaN
+     */
+    ParametersType Interpolate(PackedStellarClass Code)const noexcept;
+
+    /**
+     * @brief 批量查表得到物理参数
+     * @param Codes 压缩编码的光谱型数组
+     * @param Out 输出数组
+     * @param Threads 工作线程数，为0时自动选择
+     */
+    void Interpolate(std::span<const PackedStellarClass> Codes, ParametersType* Out,
+        uint64 Threads = 0)const;
+
+    /**
+     * @brief 批量填写物体的物理参数
+     * @param Codes 压缩编码的光谱型数组
+     * @param Objects 物体数组，长度与Codes相同
+     * @param Threads 工作线程数，为0时自动选择
+     * @details 写入 Object::Temperature、Object::Mass、Object::Dimensions（三个分量均为直径）和 Object::LumBol，
+     *          查表失败的物体保持不变。表中的光度是总光度，因此不写入视觉光度 Object::Luminosity，需要时由引擎按温度另行计算。
+     */
+    void Fill(std::span<const PackedStellarClass> Codes, Object* Objects, uint64 Threads = 0)const;
+};
+
 }
 
-}
\ No newline at end of file
+}
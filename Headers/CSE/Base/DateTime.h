@@ -382,6 +382,407 @@ public:
     ustring ToString(cstring _Fmt = "{}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}{:+03}:{:02}")const;
 };
 
+/**
+ * @class CSEEpoch
+ * @ingroup DateTime
+ * @brief 紧凑的历元类型
+ * @details 以64位整数存储自J2000.0（JD 2451545.0）起的微秒数，可平凡复制，比较和加减都是一次整数运算，不涉及历法计算，
+ *          适合作为有序容器的键和插值的自变量。
+ *
+ * 表示范围约为J2000.0前后29万年，分辨率为1微秒。作为对比，当前年代以双精度浮点数表示的儒略日分辨率约为40微秒，
+ * 因此从儒略日转换时不会损失精度；转换回儒略日时可以使用两部分的儒略日以保留全部精度。
+ *
+ * @note 此类型不记录时间尺度，同一容器中的历元应使用相同的时间尺度（如OEM的TIME_SYSTEM）。不记录时区，与 CSEDateTime
+ *       互相转换时按UTC处理。
+ */
+class CSEEpoch
+{
+    int64 Ticks = 0;                ///< 自J2000.0起的微秒数
+
+public:
+    static constexpr int64   TicksPerSecond = 1000000;   ///< 每秒的计数
+    static constexpr int64   TicksPerDay    = 86400000000; ///< 每天的计数
+    static constexpr float64 J2000          = 2451545.0; ///< J2000.0的儒略日
+
+    /**
+     * @brief 默认构造函数，历元为J2000.0
+     */
+    constexpr CSEEpoch() = default;
+
+    /**
+     * @brief 从计数构造
+     * @param MicrosecondsSinceJ2000 自J2000.0起的微秒数
+     */
+    constexpr explicit CSEEpoch(int64 MicrosecondsSinceJ2000) noexcept : Ticks(MicrosecondsSinceJ2000) {}
+
+    /**
+     * @brief 从儒略日构造
+     * @param JD 儒略日
+     */
+    static CSEEpoch FromJulianDay(float64 JD)noexcept;
+
+    /**
+     * @brief 从两部分的儒略日构造
+     * @param JD1 儒略日的第一部分（通常为整数部分或J2000.0）
+     * @param JD2 儒略日的第二部分
+     */
+    static CSEEpoch FromJulianDay(float64 JD1, float64 JD2)noexcept;
+
+    /**
+     * @brief 从日期时间构造
+     * @param DateTime 日期时间，会先转换为UTC
+     */
+    static CSEEpoch FromDateTime(const CSEDateTime& DateTime);
+
+    /// @brief 获取自J2000.0起的微秒数
+    constexpr int64 Count()const noexcept { return Ticks; }
+
+    /// @brief 转换为儒略日
+    float64 ToJulianDay()const noexcept;
+
+    /**
+     * @brief 转换为两部分的儒略日
+     * @param[out] JD1 整数部分加0.5（即当天0时的儒略日）
+     * @param[out] JD2 当天的小数部分
+     */
+    void ToJulianDay(float64* JD1, float64* JD2)const noexcept;
+
+    /// @brief 转换为UTC日期时间
+    CSEDateTime ToDateTime()const;
+
+    /// @brief 增加指定秒数
+    CSEEpoch AddSeconds(float64 Sec)const noexcept;
+
+    /// @brief 增加指定天数
+    CSEEpoch AddDays(float64 Days)const noexcept;
+
+    /// @brief 计算两个历元之差（秒）
+    float64 SecondsTo(CSEEpoch Right)const noexcept;
+
+    /// @brief 比较运算符
+    constexpr auto operator<=>(const CSEEpoch&)const = default;
+};
+
+/**
+ * @class LeapSecondTable
+ * @ingroup DateTime
+ * @brief 闰秒表
+ * @details 记录自1972年起每次闰秒后TAI与UTC的差值，查询时在表上二分查找，复杂度为O(log n)。表在构造后不可修改，可以被多个线程同时查询。
+ *
+ * 以 CSEEpoch 表示UTC时，计数中不包含闰秒本身（与POSIX时间的约定相同），23:59:60与次日00:00:00对应同一个计数，
+ * 因此UTC转换为TAI是单调的，而TAI转换为UTC时闰秒内的时刻会映射到次日00:00:00。
+ *
+ * @note 1972年以前的UTC与TAI之间存在速率调整，这里不考虑，统一返回10秒。
+ * @see https://hpiers.obspm.fr/iers/bul/bulc/Leap_Second.dat
+ */
+class LeapSecondTable
+{
+public:
+    /**
+     * @brief 闰秒表的表项
+     */
+    struct EntryType
+    {
+        CSEEpoch UTC;         ///< 生效的UTC时刻
+        int32_t  TAIMinusUTC; ///< 生效后TAI与UTC的差值（秒）
+    };
+
+protected:
+    std::vector<EntryType> Entries; ///< 按时刻升序排列的表项
+
+public:
+    /**
+     * @brief 使用内置数据构造
+     * @details 内置数据为编译时IERS公报C的闰秒表，有新的闰秒公布后需要从文件载入。
+     */
+    LeapSecondTable();
+
+    /**
+     * @brief 使用给定数据构造
+     * @param Entries 表项，不要求有序
+     */
+    explicit LeapSecondTable(std::vector<EntryType> Entries);
+
+    /**
+     * @brief 从IERS发布的leap-seconds.list文件载入
+     * @param Path 文件路径
+     * @throws std::logic_error 文件无法读取或格式错误时抛出
+     */
+    static LeapSecondTable FromFile(std::filesystem::path Path);
+
+    /**
+     * @brief 获取全局共享的闰秒表
+     * @return 首次调用时使用内置数据构造的表
+     */
+    static const LeapSecondTable& Default();
+
+    /**
+     * @brief 查询TAI与UTC的差值
+     * @param UTC UTC时刻
+     * @return TAI-UTC（秒）
+     */
+    int32_t TAIMinusUTC(CSEEpoch UTC)const;
+
+    CSEEpoch UTCToTAI(CSEEpoch UTC)const;  ///< UTC转换为TAI
+    CSEEpoch TAIToUTC(CSEEpoch TAI)const;  ///< TAI转换为UTC
+
+    /**
+     * @brief 批量将UTC转换为TAI
+     * @param In UTC时刻数组
+     * @param[out] Out TAI时刻数组，可以与输入相同
+     * @param Count 数组长度
+     * @details 输入有序时，相邻元素通常落在同一区间，因此先检查上一个元素所在的区间，不在时再二分查找。
+     */
+    void UTCToTAI(const CSEEpoch* In, CSEEpoch* Out, uint64 Count)const;
+
+    /**
+     * @brief 批量将TAI转换为UTC
+     * @param In TAI时刻数组
+     * @param[out] Out UTC时刻数组，可以与输入相同
+     * @param Count 数组长度
+     */
+    void TAIToUTC(const CSEEpoch* In, CSEEpoch* Out, uint64 Count)const;
+};
+
+/**
+ * @class TimezoneTable
+ * @ingroup DateTime
+ * @brief 预先展开的时区转换表
+ * @details CSETimezone 只记录标准时间和夏令时的切换规则，每次转换都需要按规则推算当年的切换日期。
+ *          此类在构造时把一段年份范围内的所有切换时刻展开为按UTC时刻升序排列的数组，每个元素记录切换后的UTC偏移，
+ *          之后的每次转换只需要一次二分查找和一次整数加法。
+ *
+ * 当地时间转换为UTC时，夏令时结束时重复的一小时取较早的一次（即仍按夏令时处理），夏令时开始时跳过的一小时按切换前的偏移处理。
+ */
+class TimezoneTable
+{
+public:
+    /**
+     * @brief 时区切换
+     */
+    struct TransitionType
+    {
+        CSEEpoch UTC;        ///< 切换的UTC时刻
+        int32_t  UTCOffset;  ///< 切换后相对于UTC的偏移（秒）
+        bool     Daylight;   ///< 切换后是否为夏令时
+    };
+
+protected:
+    std::vector<TransitionType> Transitions;  ///< 按时刻升序排列的切换
+    int32_t StandardOffset;                   ///< 表范围以外使用的标准时间偏移（秒）
+
+public:
+    /**
+     * @brief 从时区规则展开
+     * @param Zone 时区信息
+     * @param FirstYear 展开的起始年份
+     * @param LastYear 展开的结束年份（含）
+     */
+    TimezoneTable(const Epoch::CSETimezone& Zone, int FirstYear, int LastYear);
+
+    /**
+     * @brief 使用给定的切换数据构造
+     * @param Transitions 切换数据，不要求有序
+     * @param StandardOffset 表范围以外使用的标准时间偏移（秒）
+     */
+    TimezoneTable(std::vector<TransitionType> Transitions, int32_t StandardOffset);
+
+    /**
+     * @brief 查询UTC偏移
+     * @param UTC UTC时刻
+     * @return 当地时间相对于UTC的偏移（秒）
+     */
+    int32_t UTCOffset(CSEEpoch UTC)const;
+
+    CSEEpoch UTCToLocal(CSEEpoch UTC)const;    ///< UTC转换为当地时间
+    CSEEpoch LocalToUTC(CSEEpoch Local)const;  ///< 当地时间转换为UTC
+
+    /**
+     * @brief 批量将UTC转换为当地时间
+     * @param In UTC时刻数组
+     * @param[out] Out 当地时刻数组，可以与输入相同
+     * @param Count 数组长度
+     */
+    void UTCToLocal(const CSEEpoch* In, CSEEpoch* Out, uint64 Count)const;
+
+    /**
+     * @brief 批量将当地时间转换为UTC
+     * @param In 当地时刻数组
+     * @param[out] Out UTC时刻数组，可以与输入相同
+     * @param Count 数组长度
+     */
+    void LocalToUTC(const CSEEpoch* In, CSEEpoch* Out, uint64 Count)const;
+
+    /**
+     * @brief 将日期时间转换到此时区
+     * @param DateTime 任意时区的日期时间
+     * @return 此时区的日期时间，偏移按转换后的时刻确定
+     */
+    CSEDateTime ToLocal(const CSEDateTime& DateTime)const;
+};
+
+/**
+ * @brief 时间尺度
+ * @ingroup DateTime
+ */
+enum class TimeScale
+{
+    UTC, ///< 协调世界时
+    TAI, ///< 国际原子时
+    TT,  ///< 地球时，TT = TAI + 32.184s
+    TDB, ///< 质心动力学时
+    GPS, ///< GPS时，GPS = TAI - 19s
+};
+
+/**
+ * @brief 从CCSDS时间系统名称解析时间尺度
+ * @param Name 时间系统名称，即OEM元数据中的TIME_SYSTEM字段，如"UTC"、"TDB"
+ * @return 对应的时间尺度
+ * @throws std::logic_error 不支持的时间系统
+ */
+TimeScale __cdecl ParseTimeScale(std::string_view Name);
+
+/**
+ * @class TimeScaleConverter
+ * @ingroup DateTime
+ * @brief 时间尺度转换
+ * @details
+ * 各时间尺度之间的转换以TAI为中转：
+ * \f[
+ * \begin{aligned}
+ * \mathrm{TAI}&=\mathrm{UTC}+\Delta AT\\
+ * \mathrm{TT}&=\mathrm{TAI}+32.184\mathrm{s}\\
+ * \mathrm{GPS}&=\mathrm{TAI}-19\mathrm{s}\\
+ * \mathrm{TDB}&=\mathrm{TT}+\Delta_{\mathrm{TDB}}(\mathrm{TT})
+ * \end{aligned}
+ * \f]
+ * 其中 \f$\Delta AT\f$ 由 LeapSecondTable 查得。TAI、TT、GPS之间的偏移都是整数微秒，在 CSEEpoch 上的转换没有舍入误差。
+ *
+ * \f$\Delta_{\mathrm{TDB}}\f$ 是振幅约1.7毫秒的周期项，采用Fairhead和Bretagnon(1990)[1]的级数：
+ * \f[
+ * \Delta_{\mathrm{TDB}}=\sum_i A_iT^{k_i}\sin(\omega_iT+\varphi_i)
+ * \f]
+ * T为TT起算的J2000儒略世纪数。完整级数在1600—2200年间的误差为纳秒量级；只取前7项时即为IERS规范[2]和USNO通报179[3]中的简化公式，误差约10微秒。
+ * 由于 CSEEpoch 的分辨率为1微秒，在 CSEEpoch 上转换TDB时结果会舍入到微秒，需要更高精度时直接使用儒略日版本。
+ * TDB到TT的逆转换用TDB代替TT计算级数，两者之差\f$ \Delta \f$不到2毫秒，由此带来的误差约为\f$ A\omega\Delta \f$，
+ * 以主项计（\f$ A=1.657\mathrm{ms} \f$，\f$ \omega=2\pi/\mathrm{yr} \f$，\f$ \Delta\le1.7\mathrm{ms} \f$）约为6e-13秒。
+ *
+ * 批量计算时将历元按块处理，对每一块按级数项循环、在块内对历元循环，内层循环中的频率、振幅和相位都是常量，可以被编译器向量化。
+ * 块大小使一块的中间结果能放入L1缓存。
+ *
+ * @par 参考文献
+ * [1] Fairhead L, Bretagnon P. An analytical formula for the time transformation TB-TT[J]. Astronomy and Astrophysics, 1990, 229: 240-247.<br>
+ * [2] Petit G, Luzum B. IERS Conventions (2010)[R]. IERS Technical Note No. 36, 2010: 151-153.<br>
+ * [3] Kaplan G H. The IAU Resolutions on Astronomical Reference Systems, Time Scales, and Earth Rotation Models[R]. USNO Circular 179, 2005: 15.<br>
+ */
+class TimeScaleConverter
+{
+public:
+    /// @brief TT与TAI之差（微秒）
+    static constexpr int64 TTMinusTAITicks  = 32184000;
+    /// @brief TAI与GPS之差（微秒）
+    static constexpr int64 TAIMinusGPSTicks = 19000000;
+
+    /**
+     * @brief TDB-TT级数的一项
+     */
+    struct TDBSeriesTerm
+    {
+        float64 Amplitude; ///< 振幅（秒）
+        float64 Frequency; ///< 角频率（弧度/儒略世纪）
+        float64 Phase;     ///< 相位（弧度）
+        uint32_t Power;    ///< T的幂次
+    };
+
+    /// @brief Fairhead-Bretagnon级数，按振幅降序排列，前7项为简化公式
+    static const std::vector<TDBSeriesTerm> TDBSeries;
+
+protected:
+    const LeapSecondTable* LeapSeconds;  ///< 使用的闰秒表
+    uint64 TDBTerms;                     ///< 计算TDB-TT时使用的级数项数
+
+public:
+    /**
+     * @brief 构造转换器
+     * @param LeapSeconds 闰秒表，须在转换器的生存期内有效，默认使用全局共享的闰秒表
+     * @param TDBTerms 计算TDB-TT时使用的级数项数，为0时使用完整级数
+     */
+    TimeScaleConverter(const LeapSecondTable& LeapSeconds = LeapSecondTable::Default(), uint64 TDBTerms = 0);
+
+    /**
+     * @brief 计算TDB与TT之差
+     * @param JDTT 以TT计的儒略日
+     * @return TDB-TT（秒）
+     */
+    float64 TDBMinusTT(float64 JDTT)const;
+
+    /**
+     * @brief 批量计算TDB与TT之差
+     * @param JDTT 以TT计的儒略日数组
+     * @param[out] Out TDB-TT数组（秒），可以与输入相同
+     * @param Count 数组长度
+     * @param Threads 工作线程数，为0时自动选择
+     */
+    void TDBMinusTT(const float64* JDTT, float64* Out, uint64 Count, uint64 Threads = 0)const;
+
+    /**
+     * @brief 转换历元的时间尺度
+     * @param Epoch 历元
+     * @param From 原时间尺度
+     * @param To 目标时间尺度
+     * @return 转换后的历元
+     */
+    CSEEpoch Convert(CSEEpoch Epoch, TimeScale From, TimeScale To)const;
+
+    /**
+     * @brief 转换儒略日的时间尺度
+     * @param JD 儒略日
+     * @param From 原时间尺度
+     * @param To 目标时间尺度
+     * @return 转换后的儒略日
+     * @details 偏移量在秒上计算后再加到儒略日上，不经过 CSEEpoch，TDB的结果不舍入到微秒。
+     */
+    float64 Convert(float64 JD, TimeScale From, TimeScale To)const;
+
+    /**
+     * @brief 批量转换历元的时间尺度
+     * @param In 历元数组
+     * @param[out] Out 转换后的历元数组，可以与输入相同
+     * @param Count 数组长度
+     * @param From 原时间尺度
+     * @param To 目标时间尺度
+     * @param Threads 工作线程数，为0时自动选择
+     * @details 闰秒查询和TDB级数分别按批处理，见 LeapSecondTable::UTCToTAI(const CSEEpoch*, CSEEpoch*, uint64)const 和 TDBMinusTT(const float64*, float64*, uint64, uint64)const。
+     */
+    void Convert(const CSEEpoch* In, CSEEpoch* Out, uint64 Count, TimeScale From, TimeScale To, uint64 Threads = 0)const;
+
+    /**
+     * @brief 批量转换儒略日的时间尺度
+     * @param In 儒略日数组
+     * @param[out] Out 转换后的儒略日数组，可以与输入相同
+     * @param Count 数组长度
+     * @param From 原时间尺度
+     * @param To 目标时间尺度
+     * @param Threads 工作线程数，为0时自动选择
+     */
+    void Convert(const float64* In, float64* Out, uint64 Count, TimeScale From, TimeScale To, uint64 Threads = 0)const;
+
+    /**
+     * @brief 获取当前系统时间在指定时间尺度下的儒略日
+     * @param Scale 时间尺度
+     * @return 当前儒略日数值
+     * @see GetJDFromSystem()
+     */
+    float64 GetJDFromSystem(TimeScale Scale)const;
+
+    /**
+     * @brief 获取当前系统时间在指定时间尺度下的历元
+     * @param Scale 时间尺度
+     * @return 当前历元
+     */
+    CSEEpoch EpochFromSystem(TimeScale Scale)const;
+};
+
 /**
  * @defgroup StellariumFuncs 天文历法
  * @ingroup DateTime
@@ -577,5 +978,97 @@ int GetJulianDayFromISO8601String(const std::string& iso8601Date, double* jd);
  */
 int GetDateTimeFromISO8601String(const std::string& iso8601Date, int* y, int* m, int* d, int* h, int* min, double* s, int* offsec);
 
+/**@}*/
+
+/**
+ * @defgroup DateTimeBatch 批量日期计算
+ * @ingroup DateTime
+ * @brief 用于大量历元的日期转换
+ * @details
+ * 星历和OEM数据的处理中常常需要转换数以百万计的历元，逐个构造 CSEDateTime 或调用 StellariumFuncs 中的函数时，
+ * 大部分开销花在了日期校验、浮点取整的分支和字符串分配上。以下函数与 StellariumFuncs 中的同名函数结果相同，但是：
+ * - 儒略日与日历日期的转换采用Neri和Schneider(2022)[1]的欧几里得仿射函数算法，只用整数乘法、移位和加法，没有与月份相关的分支，
+ *   循环可以被编译器向量化。儒略历和格里历的差别只在于世纪修正项，两种历法的修正项同时算出后按日期用掩码选择，同样没有分支；
+ * - ISO 8601字符串的格式化和解析直接读写调用方提供的缓冲区，不分配内存。
+ *
+ * @par 参考文献
+ * [1] Neri C, Schneider L. Euclidean affine functions and their application to calendar algorithms[J]. Software: Practice and Experience, 2023, 53(4): 937-970.<br>
+ * @{
+ */
+
+/// @brief ISO 8601格式化所需的最小缓冲区长度（含结尾的空字符）
+inline constexpr uint64 ISO8601BufferSize = 32;
+
+/**
+ * @brief 批量从儒略日提取年月日
+ * @param JD 儒略日数组
+ * @param[out] yy 年数组
+ * @param[out] mm 月数组
+ * @param[out] dd 日数组
+ * @param Count 数组长度
+ * @see GetDateFromJulianDay(const double, int*, int*, int*)
+ */
+void __cdecl GetDateFromJulianDay(const float64* JD, int* yy, int* mm, int* dd, uint64 Count);
+
+/**
+ * @brief 批量从儒略日完整提取日期时间
+ * @param JD 儒略日数组
+ * @param[out] year 年数组
+ * @param[out] month 月数组
+ * @param[out] day 日数组
+ * @param[out] hour 时数组
+ * @param[out] minute 分数组
+ * @param[out] second 秒数组
+ * @param[out] millis 毫秒数组
+ * @param Count 数组长度
+ * @see GetDateTimeFromJulianDay(const double, int*, int*, int*, int*, int*, int*, int*)
+ */
+void __cdecl GetDateTimeFromJulianDay(const float64* JD, int* year, int* month, int* day,
+    int* hour, int* minute, int* second, int* millis, uint64 Count);
+
+/**
+ * @brief 批量从日历日期计算儒略日
+ * @param[out] JD 儒略日数组
+ * @param y 年数组
+ * @param m 月数组（1-12）
+ * @param d 日数组
+ * @param h 时数组
+ * @param min 分数组
+ * @param s 秒数组
+ * @param Count 数组长度
+ * @note 与 GetJDFromDate 相同，1582年10月15日前使用儒略历。此函数不校验日期，无效日期的结果未定义。
+ */
+void __cdecl GetJDFromDate(float64* JD, const int* y, const int* m, const int* d,
+    const int* h, const int* min, const float64* s, uint64 Count);
+
+/**
+ * @brief 将儒略日格式化为ISO8601日期字符串，写入调用方的缓冲区
+ * @param jd 儒略日数值
+ * @param[out] Buffer 输出缓冲区
+ * @param Size 缓冲区长度，至少为 ISO8601BufferSize
+ * @param addMS 是否包含毫秒（默认包含）
+ * @return 写入的字符数（不含结尾的空字符），缓冲区不足时返回0
+ * @see JulianDayToISO8601String(const double, bool)
+ */
+uint64 __cdecl JulianDayToISO8601String(const double jd, char* Buffer, uint64 Size, bool addMS = true)noexcept;
+
+/**
+ * @brief 从ISO8601字符串解析儒略日，不复制字符串
+ * @details 与 GetJulianDayFromISO8601String 分开命名，避免以字符串字面量调用时与const std::string&版本产生二义性。
+ * @param iso8601Date ISO8601格式日期字符串
+ * @param[out] jd 计算结果儒略日（输出参数）
+ * @return 操作状态码，与 GetJulianDayFromISO8601String(const std::string&, double*) 相同
+ */
+int __cdecl GetJulianDayFromISO8601View(std::string_view iso8601Date, double* jd)noexcept;
+
+/**
+ * @brief 批量从ISO8601字符串解析儒略日
+ * @param Dates ISO8601格式日期字符串数组
+ * @param[out] JD 儒略日数组
+ * @param[out] Status 操作状态码数组，可以为空指针
+ * @param Count 数组长度
+ */
+void __cdecl GetJulianDayFromISO8601View(const std::string_view* Dates, double* JD, int* Status, uint64 Count)noexcept;
+
 /**@}*/
 }
\ No newline at end of file
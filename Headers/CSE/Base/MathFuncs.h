@@ -10,6 +10,186 @@
  * @note <i>「宇宙之大，粒子之微。火箭之速，化工之巧。星球之变，生命之谜。日用其繁，无不数学。」</i>
  */
 
+/**
+ * @defgroup MathFuncsSIMD 向量化内核
+ * @ingroup MathFuncs
+ * @brief 向量版本数学函数使用的SIMD内核及其运行时分派
+ * @details
+ * fvec<N>版本的数学函数原先对每个分量调用一次标量函数，标量函数中的查表、分支和特殊值处理使编译器无法将循环向量化。
+ * 现在这些函数调用以下内核，内核与标量函数使用相同的算法（相同的查表和多项式系数），只是在SIMD寄存器的各通道上同时计算：
+ * - 查表改为gather（AVX2、AVX-512）或逐通道加载后拼装（SSE2）；
+ * - 标量函数中区分输入范围的分支改为对各通道分别求出比较掩码，主路径在所有通道上计算，
+ *   只有掩码非空时才对落入特殊区间（非规格化数、溢出、无穷大、NaN、大参数的辐角约化等）的通道调用标量函数重新计算；
+ * - 不足一个寄存器宽度的尾部使用掩码加载和存储（AVX-512），或复制到栈上的临时寄存器中计算（SSE2、AVX2）。
+ *
+ * 所有指令集的内核与正确舍入结果的误差都不超过1 ULP。AVX2和AVX-512内核在多项式求值中使用FMA，舍入位置与标量函数不同，
+ * 因此个别结果可能与标量函数在最后一位上不同，但都在此误差界以内。
+ *
+ * 内核按指令集分别编译，首次调用 __Get_Vector_Math_Kernels() 时根据CPUID检测结果选择最高的可用指令集，之后的调用只是读取一个指针。
+ * 各指令集的启用条件如下，任一条件不满足即降级：
+ * - AVX2：CPUID.7:EBX.AVX2、CPUID.1:ECX.FMA和CPUID.1:ECX.OSXSAVE均置位，且XGETBV报告操作系统保存了XMM和YMM状态。
+ *   存在只有AVX2而没有FMA的处理器（或虚拟机屏蔽了FMA），只检查AVX2位会在这些机器上触发非法指令；
+ * - AVX512：在AVX2的条件之外，CPUID.7:EBX.AVX512F置位，且XGETBV报告操作系统保存了opmask和ZMM状态。
+ * 编译选项EnableSIMDDispatch关闭时只编译标量内核。
+ *
+ * 三角函数内核遵循编译选项TrigonoUseRadians，与标量函数使用相同的角度单位。
+ * @{
+ */
+
+/**
+ * @brief SIMD指令集
+ */
+enum class SIMDInstructionSet : uint32_t
+{
+    Scalar, ///< 不使用SIMD，逐元素调用标量函数
+    SSE2,   ///< 128位，每次2个双精度数
+    AVX2,   ///< 256位，每次4个双精度数，使用FMA
+    AVX512, ///< 512位，每次8个双精度数（AVX-512F）
+};
+
+/**
+ * @brief 获取当前使用的指令集
+ * @return 首次调用时为CPU支持的最高指令集，或者最近一次 SetSIMDInstructionSet 设置的指令集
+ */
+SIMDInstructionSet __cdecl GetSIMDInstructionSet()noexcept;
+
+/**
+ * @brief 设置使用的指令集
+ * @param Set 期望的指令集
+ * @return 实际使用的指令集，CPU或编译选项不支持时降级到可用的最高指令集
+ * @details 主要用于在同一台机器上比较各指令集内核与标量函数的结果。此函数不是线程安全的，应在程序启动时或测试中调用。
+ */
+SIMDInstructionSet __cdecl SetSIMDInstructionSet(SIMDInstructionSet Set)noexcept;
+
+/**
+ * @brief 向量化内核表
+ * @details 每个一元内核的参数为输入数组、输出数组和元素个数，输入和输出可以相同。
+ */
+struct __Vector_Math_Kernel_Table
+{
+    using UnaryKernel        = void(__cdecl*)(const float64* In, float64* Out, uint64 Count)noexcept;
+    using BinaryKernel       = void(__cdecl*)(const float64* Left, const float64* Right, float64* Out, uint64 Count)noexcept;
+    using ScalarBinaryKernel = void(__cdecl*)(const float64* Left, float64 Right, float64* Out, uint64 Count)noexcept;
+    using SinCosKernel       = void(__cdecl*)(const float64* In, float64* Sin, float64* Cos, uint64 Count)noexcept;
+
+    SIMDInstructionSet InstructionSet; ///< 内核对应的指令集
+
+    UnaryKernel exp;           ///< 自然指数
+    UnaryKernel ln;            ///< 自然对数
+    UnaryKernel log;           ///< 常用对数
+    BinaryKernel pow;          ///< 幂（指数为数组）
+    ScalarBinaryKernel pows;   ///< 幂（指数为标量）
+    UnaryKernel sqrt;          ///< 平方根
+    UnaryKernel inversesqrt;   ///< 平方根倒数
+    UnaryKernel cbrt;          ///< 立方根
+    UnaryKernel sin;           ///< 正弦
+    UnaryKernel cos;           ///< 余弦
+    UnaryKernel tan;           ///< 正切
+    SinCosKernel sincos;       ///< 同时计算正弦和余弦
+    UnaryKernel arcsin;        ///< 反正弦
+    UnaryKernel arccos;        ///< 反余弦
+    UnaryKernel arctan;        ///< 反正切
+    BinaryKernel Arctan2;      ///< 二元反正切，Left为y，Right为x
+    UnaryKernel sinh;          ///< 双曲正弦
+    UnaryKernel cosh;          ///< 双曲余弦
+    UnaryKernel tanh;          ///< 双曲正切
+};
+
+/**
+ * @brief 获取当前指令集的内核表
+ * @return 内核表
+ */
+const __Vector_Math_Kernel_Table& __cdecl __Get_Vector_Math_Kernels()noexcept;
+
+/**
+ * @brief 获取指定指令集的内核表
+ * @param Set 指令集
+ * @return 内核表，CPU或编译选项不支持时返回空指针
+ */
+const __Vector_Math_Kernel_Table* __cdecl __Get_Vector_Math_Kernels(SIMDInstructionSet Set)noexcept;
+
+/**@}*/
+
+/**
+ * @defgroup MathFuncsBulk 批量数学函数
+ * @ingroup MathFuncs
+ * @brief 对大数组逐元素计算的数学函数
+ * @details
+ * 对一个大数组逐个调用标量函数时，编译器无法看到 __cdecl 函数内部，循环不能被向量化。以下函数直接把整个数组交给 MathFuncsSIMD 中的内核：
+ * - 元素个数不超过 BulkMathThreadThreshold 时在调用线程上计算；
+ * - 超过时把数组按缓存行对齐切成连续的块，分给多个线程计算，每个线程只写自己的块，不需要同步。
+ *
+ * 输出可以与输入是同一个数组（原地计算），但不能与输入部分重叠。输出的长度不能小于输入，否则抛出 std::logic_error。
+ * 二元函数的两个输入长度必须相同。结果与 fvec 版本相同，与标量函数的误差界相同。
+ * @{
+ */
+
+/// @brief 启用多线程计算的最小元素个数
+inline constexpr uint64 BulkMathThreadThreshold = 65536;
+
+/**
+ * @brief 批量计算自然指数
+ * @param _X 输入数组
+ * @param[out] _Out 输出数组，可以与输入相同
+ * @param Threads 工作线程数，为0时自动选择
+ */
+void __cdecl exp(std::span<const float64> _X, std::span<float64> _Out, uint64 Threads = 0);
+
+/**
+ * @brief 批量计算自然对数
+ * @param _X 输入数组
+ * @param[out] _Out 输出数组，可以与输入相同
+ * @param Threads 工作线程数，为0时自动选择
+ */
+void __cdecl ln(std::span<const float64> _X, std::span<float64> _Out, uint64 Threads = 0);
+
+/**
+ * @brief 批量计算幂（指数为数组）
+ * @param _X 底数数组
+ * @param _Power 指数数组
+ * @param[out] _Out 输出数组，可以与任一输入相同
+ * @param Threads 工作线程数，为0时自动选择
+ */
+void __cdecl pow(std::span<const float64> _X, std::span<const float64> _Power, std::span<float64> _Out, uint64 Threads = 0);
+
+/**
+ * @brief 批量计算幂（指数为标量）
+ * @param _X 底数数组
+ * @param _Power 指数
+ * @param[out] _Out 输出数组，可以与输入相同
+ * @param Threads 工作线程数，为0时自动选择
+ */
+void __cdecl pow(std::span<const float64> _X, float64 _Power, std::span<float64> _Out, uint64 Threads = 0);
+
+/**
+ * @brief 批量计算平方根
+ * @param _X 输入数组
+ * @param[out] _Out 输出数组，可以与输入相同
+ * @param Threads 工作线程数，为0时自动选择
+ */
+void __cdecl sqrt(std::span<const float64> _X, std::span<float64> _Out, uint64 Threads = 0);
+
+/**
+ * @brief 批量同时计算正弦和余弦
+ * @param _X 角度数组（单位与标量三角函数相同）
+ * @param[out] _Sin 正弦数组，可以与输入相同
+ * @param[out] _Cos 余弦数组，可以与输入相同，但不能与_Sin相同
+ * @param Threads 工作线程数，为0时自动选择
+ * @details 每个元素只进行一次辐角约化和查表，见 sincos(Angle, float64*, float64*)。
+ */
+void __cdecl sincos(std::span<const float64> _X, std::span<float64> _Sin, std::span<float64> _Cos, uint64 Threads = 0);
+
+/**
+ * @brief 批量计算二元反正切
+ * @param _Y y坐标数组
+ * @param _X x坐标数组
+ * @param[out] _Out 角度数组（单位与 Arctan2(float64, float64) 相同），可以与任一输入相同
+ * @param Threads 工作线程数，为0时自动选择
+ */
+void __cdecl Arctan2(std::span<const float64> _Y, std::span<const float64> _X, std::span<float64> _Out, uint64 Threads = 0);
+
+/**@}*/
+
 /**
  * @defgroup MathFuncsExp 指数函数
  * @ingroup MathFuncs
@@ -162,7 +342,9 @@ complex64 __cdecl expc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl exp(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE exp(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().exp(&_X[0], &f[0], N);
+    return f;
 }
 
 /**@}*/
@@ -514,7 +696,9 @@ complex64 __cdecl logc(complex64 _X, complex64 _Base, int64 _K = 0);
 template<std::size_t N>
 fvec<N> __cdecl ln(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE ln(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().ln(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -526,7 +710,9 @@ fvec<N> __cdecl ln(fvec<N> _X)
 template<std::size_t N>
 fvec<N> __cdecl log(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE log(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().log(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -956,7 +1142,9 @@ complex64 __cdecl powc(complex64 _X, complex64 _Power, int64 _K = 0);
 template<std::size_t N>
 fvec<N> __cdecl pow(fvec<N> _X, float64 _Power)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE pow(_X[i], _Power))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().pows(&_X[0], _Power, &f[0], N);
+    return f;
 }
 
 /**
@@ -969,7 +1157,9 @@ fvec<N> __cdecl pow(fvec<N> _X, float64 _Power)
 template<std::size_t N>
 fvec<N> __cdecl pow(fvec<N> _X, fvec<N> _Power)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE pow(_X[i], _Power[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().pow(&_X[0], &_Power[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -1012,7 +1202,9 @@ std::array<complex64, 2> __cdecl sqrtc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl sqrt(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE sqrt(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().sqrt(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -1038,7 +1230,9 @@ std::array<complex64, 2> __cdecl inversesqrtc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl inversesqrt(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE inversesqrt(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().inversesqrt(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -1064,7 +1258,9 @@ std::array<complex64, 3> __cdecl cbrtc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl cbrt(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE cbrt(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().cbrt(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2122,7 +2318,9 @@ complex64 __cdecl sinc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl sin(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE sin(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().sin(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2143,7 +2341,39 @@ complex64 __cdecl cosc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl cos(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE cos(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().cos(&_X[0], &f[0], N);
+    return f;
+}
+
+/**
+ * @brief 同时计算正弦和余弦
+ * @param _X 角度值
+ * @param[out] _Sin 正弦值
+ * @param[out] _Cos 余弦值
+ * @details sin(Angle)和cos(Angle)各自进行辐角约化并查询`__SinCos128F_Table`，而约化得到的象限和表项对两者是相同的：
+ * 若 \f$ x = \frac{\pi}{2}q + x_i + h \f$，表项给出 \f$ \sin x_i \f$ 和 \f$ \cos x_i \f$，多项式给出 \f$ \sin h \f$ 和 \f$ \cos h \f$，则
+ * \f[
+ * \begin{aligned}
+ * \sin(x_i+h)&=\sin x_i\cos h+\cos x_i\sin h\\
+ * \cos(x_i+h)&=\cos x_i\cos h-\sin x_i\sin h
+ * \end{aligned}
+ * \f]
+ * 再按象限q交换和取反。此函数只进行一次约化和查表，两个结果与分别调用sin和cos逐位相同。
+ */
+void __cdecl sincos(Angle _X, float64* _Sin, float64* _Cos);
+
+/**
+ * @brief 同时计算向量各元素的正弦和余弦
+ * @tparam N 向量维度
+ * @param _X 角度向量
+ * @param[out] _Sin 各元素正弦值向量
+ * @param[out] _Cos 各元素余弦值向量
+ */
+template<std::size_t N>
+void __cdecl sincos(fvec<N> _X, fvec<N>* _Sin, fvec<N>* _Cos)
+{
+    __Get_Vector_Math_Kernels().sincos(&_X[0], &(*_Sin)[0], &(*_Cos)[0], N);
 }
 
 /**
@@ -2164,9 +2394,123 @@ complex64 __cdecl tanc(complex64 _X);
 template<std::size_t N>
 fvec<N> __cdecl tan(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE tan(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().tan(&_X[0], &f[0], N);
+    return f;
 }
 
+/**
+ * @brief 三角函数的精度等级
+ * @details 作为 sin、cos、tan 和 sincos 的模板参数，在调用处选择精度和速度的折中，不带模板参数的版本即为Precise。
+ * 这些模板函数的参数始终以度为单位。
+ *
+ * Fast和Approx都先把参数精确地约化到\f$ r\in[-45^\circ, 45^\circ] \f$：\f$ r = x - 90^\circ k \f$，k为最接近\f$ x/90^\circ \f$的整数，
+ * 由remquo得到。由于90是整数，这一步在binary64中没有舍入误差（对任意有限的x均成立），k的低两位决定象限。
+ * 因此两者的误差界与|x|无关，并且在正弦和余弦的零点（90°的整数倍）附近同样保持相对精度。
+ *
+ * | 等级    | 误差界（任意有限参数）                      | 算法                                                                 |
+ * |---------|---------------------------------------------|----------------------------------------------------------------------|
+ * | Precise | 不超过0.52 ULP                              | 现有实现：双双精度约化，`__SinCos128F_Table`查表和多项式修正           |
+ * | Fast    | 不超过2 ULP                                 | 精确约化后以双双精度的π/180转换为弧度，[-π/4, π/4]上的13次（正弦）和14次（余弦）极小极大多项式，不查表 |
+ * | Approx  | 相对误差不超过1e-7，tan不超过2e-7            | 精确约化后以360°/256为步长查表（OpenCV的方法），余量h不超过0.703125°，\f$ \sin h \f$取到3次项，\f$ \cos h \f$取到2次项 |
+ *
+ * Approx的误差主要来自\f$ \cos h \f$的截断，约为\f$ h^4/24 < 10^{-9} \f$；90°的整数倍恰好是表的节点，
+ * 因此在零点附近结果直接为\f$ \pm\sin h \f$，相对误差仍在上述界内，其余位置\f$ |\sin x| \f$和\f$ |\cos x| \f$都不小于\f$ \sin 0.703125^\circ \f$。
+ *
+ * Fast和Approx没有分支，其SIMD内核在各通道上不需要回退到标量路径。无穷大和NaN参数在三个等级上的处理相同。
+ *
+ * 用法：
+ * ```cpp
+ * float64 s = sin<TrigAccuracy::Fast>(x);
+ * sincos<TrigAccuracy::Approx>(x, &s, &c);
+ * ```
+ */
+struct TrigAccuracy
+{
+    /// @brief 最高精度，与不带模板参数的函数相同
+    struct Precise
+    {
+        constexpr static const float64 MaxULP = 0.52;
+    };
+
+    /// @brief 1—2 ULP
+    struct Fast
+    {
+        constexpr static const float64 MaxULP = 2;
+    };
+
+    /// @brief 约1e-7
+    struct Approx
+    {
+        constexpr static const float64 MaxRelError = 1E-7;
+    };
+};
+
+/**
+ * @brief 以指定精度计算正弦函数
+ * @tparam _Accuracy 精度等级，见 TrigAccuracy
+ * @param _X 角度值
+ * @return 正弦值
+ */
+template<typename _Accuracy>
+float64 __cdecl sin(Angle _X);
+
+/**
+ * @brief 以指定精度计算余弦函数
+ * @tparam _Accuracy 精度等级，见 TrigAccuracy
+ * @param _X 角度值
+ * @return 余弦值
+ */
+template<typename _Accuracy>
+float64 __cdecl cos(Angle _X);
+
+/**
+ * @brief 以指定精度计算正切函数
+ * @tparam _Accuracy 精度等级，见 TrigAccuracy
+ * @param _X 角度值
+ * @return 正切值
+ */
+template<typename _Accuracy>
+float64 __cdecl tan(Angle _X);
+
+/**
+ * @brief 以指定精度同时计算正弦和余弦
+ * @tparam _Accuracy 精度等级，见 TrigAccuracy
+ * @param _X 角度值
+ * @param[out] _Sin 正弦值
+ * @param[out] _Cos 余弦值
+ */
+template<typename _Accuracy>
+void __cdecl sincos(Angle _X, float64* _Sin, float64* _Cos);
+
+/**
+ * @brief 以指定精度批量同时计算正弦和余弦
+ * @tparam _Accuracy 精度等级，见 TrigAccuracy
+ * @param _X 角度数组
+ * @param[out] _Sin 正弦数组，可以与输入相同
+ * @param[out] _Cos 余弦数组，可以与输入相同，但不能与_Sin相同
+ * @param Threads 工作线程数，为0时自动选择
+ * @see sincos(std::span<const float64>, std::span<float64>, std::span<float64>, uint64)
+ */
+template<typename _Accuracy>
+void __cdecl sincos(std::span<const float64> _X, std::span<float64> _Sin, std::span<float64> _Cos, uint64 Threads = 0);
+
+template<> float64 __cdecl sin<TrigAccuracy::Precise>(Angle _X);
+template<> float64 __cdecl sin<TrigAccuracy::Fast>(Angle _X);
+template<> float64 __cdecl sin<TrigAccuracy::Approx>(Angle _X);
+template<> float64 __cdecl cos<TrigAccuracy::Precise>(Angle _X);
+template<> float64 __cdecl cos<TrigAccuracy::Fast>(Angle _X);
+template<> float64 __cdecl cos<TrigAccuracy::Approx>(Angle _X);
+template<> float64 __cdecl tan<TrigAccuracy::Precise>(Angle _X);
+template<> float64 __cdecl tan<TrigAccuracy::Fast>(Angle _X);
+template<> float64 __cdecl tan<TrigAccuracy::Approx>(Angle _X);
+template<> void __cdecl sincos<TrigAccuracy::Precise>(Angle _X, float64* _Sin, float64* _Cos);
+template<> void __cdecl sincos<TrigAccuracy::Fast>(Angle _X, float64* _Sin, float64* _Cos);
+template<> void __cdecl sincos<TrigAccuracy::Approx>(Angle _X, float64* _Sin, float64* _Cos);
+template<> void __cdecl sincos<TrigAccuracy::Precise>(std::span<const float64> _X, std::span<float64> _Sin, std::span<float64> _Cos, uint64 Threads);
+template<> void __cdecl sincos<TrigAccuracy::Fast>(std::span<const float64> _X, std::span<float64> _Sin, std::span<float64> _Cos, uint64 Threads);
+template<> void __cdecl sincos<TrigAccuracy::Approx>(std::span<const float64> _X, std::span<float64> _Sin, std::span<float64> _Cos, uint64 Threads);
+
 /**
  * @brief 计算余切函数
  * @param _X 角度值（实函数使用度，复函数使用弧度）
@@ -2278,7 +2622,9 @@ complex64 __cdecl arcsinc(complex64 _X, int _N = 0, int64 _K = 0);
 template<std::size_t N>
 fvec<N> __cdecl arcsin(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE arcsin(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().arcsin(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2306,7 +2652,9 @@ complex64 __cdecl arccosc(complex64 _X, int _N = 0, int64 _K = 0);
 template<std::size_t N>
 fvec<N> __cdecl arccos(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE arccos(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().arccos(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2333,7 +2681,9 @@ complex64 __cdecl arctanc(complex64 _X, int64 _K = 0);
 template<std::size_t N>
 fvec<N> __cdecl arctan(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE arctan(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().arctan(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2590,6 +2940,7 @@ uint64 SolvePoly(
  * @ingroup MathFuncs
  * @brief 双曲函数包含sinh, cosh, tanh, coth, sech和csch这六个函数和它们的反函数
  * @details 这些函数的实现均采用Sun Microsystems的方案。
+ * 复数版本使用弧度，由实部和虚部的实双曲函数与三角函数组合而成；反函数由 lnc 和 sqrtc 构成，分支参数_N和_K的含义与 arcsinc、arctanc 相同。
  * @{
  */
 
@@ -2604,9 +2955,10 @@ float64 __cdecl sinh(float64 _X);
  * @brief 计算复数双曲正弦函数
  * @param _X 输入值(复数)
  * @return 复数双曲正弦值
- * @todo 待实现
+ * @details \f[ \sinh(x+iy)=\sinh x\cos y+i\cosh x\sin y \f]
+ * 虚部使用弧度，其正弦和余弦通过 sincos(Angle::FromRadians(y), ...) 成对计算。|x|>709时按\f$ \left(\frac{1}{2}e^{|x|/2}\cos y\right)e^{|x|/2} \f$的顺序相乘，避免结果仍可表示时提前溢出。
  */
-complex64 __cdecl sinhc(complex64 _X); // TODO
+complex64 __cdecl sinhc(complex64 _X);
 
 /**
  * @brief 计算向量双曲正弦函数
@@ -2617,7 +2969,9 @@ complex64 __cdecl sinhc(complex64 _X); // TODO
 template<std::size_t N>
 fvec<N> __cdecl sinh(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE sinh(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().sinh(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2631,9 +2985,10 @@ float64 __cdecl cosh(float64 _X);
  * @brief 计算复数双曲余弦函数
  * @param _X 输入值(复数)
  * @return 复数双曲余弦值
- * @todo 待实现
+ * @details \f[ \cosh(x+iy)=\cosh x\cos y+i\sinh x\sin y \f]
+ * 虚部使用弧度，大参数的处理与 sinhc 相同。
  */
-complex64 __cdecl coshc(complex64 _X); // TODO
+complex64 __cdecl coshc(complex64 _X);
 
 /**
  * @brief 计算向量双曲余弦函数
@@ -2644,7 +2999,9 @@ complex64 __cdecl coshc(complex64 _X); // TODO
 template<std::size_t N>
 fvec<N> __cdecl cosh(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE cosh(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().cosh(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2658,9 +3015,10 @@ float64 __cdecl tanh(float64 _X);
  * @brief 计算复数双曲正切函数
  * @param _X 输入值(复数)
  * @return 复数双曲正切值
- * @todo 待实现
+ * @details \f[ \tanh(x+iy)=\frac{\sinh 2x+i\sin 2y}{\cosh 2x+\cos 2y} \f]
+ * 采用Kahan的形式计算，|x|>22时实部为±1，虚部按\f$ 4\sin y\cos y\,e^{-2|x|} \f$计算，不会溢出。
  */
-complex64 __cdecl tanhc(complex64 _X); // TODO
+complex64 __cdecl tanhc(complex64 _X);
 
 /**
  * @brief 计算向量双曲正切函数
@@ -2671,7 +3029,9 @@ complex64 __cdecl tanhc(complex64 _X); // TODO
 template<std::size_t N>
 fvec<N> __cdecl tanh(fvec<N> _X)
 {
-    __stelcxx_array_math_function_body(f, i, _CSE tanh(_X[i]))
+    fvec<N> f;
+    __Get_Vector_Math_Kernels().tanh(&_X[0], &f[0], N);
+    return f;
 }
 
 /**
@@ -2685,9 +3045,10 @@ float64 __cdecl coth(float64 _X);
  * @brief 计算复数双曲余切函数
  * @param _X 输入值(复数)
  * @return 复数双曲余切值
- * @todo 待实现
+ * @details \f[ \coth z=\frac{1}{\tanh z}=\frac{\sinh 2x-i\sin 2y}{\cosh 2x-\cos 2y} \f]
+ * z为\f$ i\pi k \f$时分母为零，结果的分量为无穷大或NaN。
  */
-complex64 __cdecl coth(complex64 _X); // TODO
+complex64 __cdecl coth(complex64 _X);
 
 /**
  * @brief 计算向量双曲余切函数
@@ -2712,9 +3073,9 @@ float64 __cdecl sech(float64 _X);
  * @brief 计算复数双曲正割函数
  * @param _X 输入值(复数)
  * @return 复数双曲正割值
- * @todo 待实现
+ * @details \f[ \mathrm{sech}\,z=\frac{1}{\cosh z}=\frac{2(\cosh x\cos y-i\sinh x\sin y)}{\cosh 2x+\cos 2y} \f]
  */
-complex64 __cdecl sechc(complex64 _X); // TODO
+complex64 __cdecl sechc(complex64 _X);
 
 /**
  * @brief 计算向量双曲正割函数
@@ -2739,9 +3100,10 @@ float64 __cdecl csch(float64 _X);
  * @brief 计算复数双曲余割函数
  * @param _X 输入值(复数)
  * @return 复数双曲余割值
- * @todo 待实现
+ * @details \f[ \mathrm{csch}\,z=\frac{1}{\sinh z}=\frac{2(\sinh x\cos y-i\cosh x\sin y)}{\cosh 2x-\cos 2y} \f]
+ * z为\f$ i\pi k \f$时分母为零，结果的分量为无穷大或NaN。
  */
-complex64 __cdecl cschc(complex64 _X); // TODO
+complex64 __cdecl cschc(complex64 _X);
 
 /**
  * @brief 计算向量双曲余割函数
@@ -2768,9 +3130,11 @@ float64 __cdecl arsinh(float64 _X);
  * @param _N 分支选择参数(默认为0)
  * @param _K 分支选择参数(默认为0)
  * @return 复数反双曲正弦值
- * @todo 待实现
+ * @details \f[ \mathrm{arsinh}\,z=\ln\left(z+\sqrt{z^2+1}\right) \f]
+ * 其中平方根取 sqrtc(z²+1) 的第_N个根，对数取 lnc 的第_K个分支（即加上\f$ 2\pi iK \f$），与 arcsinc 的约定相同。
+ * _N和_K均为0时为主值，与std::asinh一致，此时按 \f$ \mathrm{arsinh}\,z=-\mathrm{arsinh}(-z) \f$ 将z换到右半平面再计算，避免实部为较大负数时的相消。
  */
-complex64 __cdecl arsinhc(complex64 _X, int _N = 0, int64 _K = 0); // TODO
+complex64 __cdecl arsinhc(complex64 _X, int _N = 0, int64 _K = 0);
 
 /**
  * @brief 计算向量反双曲正弦函数
@@ -2797,9 +3161,11 @@ float64 __cdecl arcosh(float64 _X);
  * @param _N 分支选择参数(默认为0)
  * @param _K 分支选择参数(默认为0)
  * @return 复数反双曲余弦值
- * @todo 待实现
+ * @details \f[ \mathrm{arcosh}\,z=\ln\left(z+\sqrt{z^2-1}\right) \f]
+ * 平方根和对数的分支选择与 arsinhc 相同。
+ * _N和_K均为0时为主值，与std::acosh一致，此时平方根按\f$ \sqrt{z-1}\sqrt{z+1} \f$计算，使分支切割位于实轴上的\f$ (-\infty,1] \f$，并避免z接近±1时的相消。
  */
-complex64 __cdecl arcoshc(complex64 _X, int _N = 0, int64 _K = 0); // TODO
+complex64 __cdecl arcoshc(complex64 _X, int _N = 0, int64 _K = 0);
 
 /**
  * @brief 计算向量反双曲余弦函数
@@ -2825,9 +3191,11 @@ float64 __cdecl artanh(float64 _X);
  * @param _X 输入值(复数)
  * @param _K 分支选择参数(默认为0)
  * @return 复数反双曲正切值
- * @todo 待实现
+ * @details \f[ \mathrm{artanh}\,z=\frac{1}{2}\ln\frac{1+z}{1-z} \f]
+ * 对数取 lnc 的第_K个分支，因此不同分支之间相差\f$ \pi iK \f$，与 arctanc 的约定相同。
+ * _K为0时为主值，与std::atanh一致，实际按\f$ \frac{1}{2}[\ln(1+z)-\ln(1-z)] \f$计算以避免z接近0时的相消。z为±1时实部为±∞。
  */
-complex64 __cdecl artanhc(complex64 _X, int64 _K = 0); // TODO
+complex64 __cdecl artanhc(complex64 _X, int64 _K = 0);
 
 /**
  * @brief 计算向量反双曲正切函数
@@ -2853,9 +3221,10 @@ float64 __cdecl arcoth(float64 _X);
  * @param _X 输入值(复数)
  * @param _K 分支选择参数(默认为0)
  * @return 复数反双曲余切值
- * @todo 待实现
+ * @details \f[ \mathrm{arcoth}\,z=\mathrm{artanh}\frac{1}{z}=\frac{1}{2}\ln\frac{z+1}{z-1} \f]
+ * 分支选择与 artanhc 相同。
  */
-complex64 __cdecl arcothc(complex64 _X, int64 _K = 0); // TODO
+complex64 __cdecl arcothc(complex64 _X, int64 _K = 0);
 
 /**
  * @brief 计算向量反双曲余切函数
@@ -2882,9 +3251,10 @@ float64 __cdecl arsech(float64 _X);
  * @param _N 分支选择参数(默认为0)
  * @param _K 分支选择参数(默认为0)
  * @return 复数反双曲正割值
- * @todo 待实现
+ * @details \f[ \mathrm{arsech}\,z=\mathrm{arcosh}\frac{1}{z}=\ln\left(\frac{1+\sqrt{1-z^2}}{z}\right) \f]
+ * 分支选择与 arcoshc 相同。
  */
-complex64 __cdecl arsechc(complex64 _X, int _N = 0, int64 _K = 0); // TODO
+complex64 __cdecl arsechc(complex64 _X, int _N = 0, int64 _K = 0);
 
 /**
  * @brief 计算向量反双曲正割函数
@@ -2911,9 +3281,10 @@ float64 __cdecl arcsch(float64 _X);
  * @param _N 分支选择参数(默认为0)
  * @param _K 分支选择参数(默认为0)
  * @return 复数反双曲余割值
- * @todo 待实现
+ * @details \f[ \mathrm{arcsch}\,z=\mathrm{arsinh}\frac{1}{z}=\ln\left(\frac{1+\sqrt{1+z^2}}{z}\right) \f]
+ * 分支选择与 arsinhc 相同。
  */
-complex64 __cdecl arcschc(complex64 _X, int _N = 0, int64 _K = 0); // TODO
+complex64 __cdecl arcschc(complex64 _X, int _N = 0, int64 _K = 0);
 
 /**
  * @brief 计算向量反双曲余割函数
@@ -2927,4 +3298,25 @@ fvec<N> __cdecl arcsch(fvec<N> _X)
     __stelcxx_array_math_function_body(f, i, _CSE arcsch(_X[i]))
 }
 
+/**
+ * @name 复数双曲函数的批量版本
+ * @details 对复数数组逐元素计算，结果与对应的标量函数相同。实部和虚部在内核中拆分为两个连续的实数数组，
+ *          其中的实双曲函数和三角函数通过 MathFuncsSIMD 的内核计算；超过 BulkMathThreadThreshold 时分给多个线程。
+ *          输出可以与输入是同一个数组，长度不能小于输入，否则抛出 std::logic_error。分支参数对所有元素相同。
+ * @{
+ */
+void __cdecl sinhc(std::span<const complex64> _X, std::span<complex64> _Out, uint64 Threads = 0);  ///< @see sinhc(complex64)
+void __cdecl coshc(std::span<const complex64> _X, std::span<complex64> _Out, uint64 Threads = 0);  ///< @see coshc(complex64)
+void __cdecl tanhc(std::span<const complex64> _X, std::span<complex64> _Out, uint64 Threads = 0);  ///< @see tanhc(complex64)
+void __cdecl coth(std::span<const complex64> _X, std::span<complex64> _Out, uint64 Threads = 0);   ///< @see coth(complex64)
+void __cdecl sechc(std::span<const complex64> _X, std::span<complex64> _Out, uint64 Threads = 0);  ///< @see sechc(complex64)
+void __cdecl cschc(std::span<const complex64> _X, std::span<complex64> _Out, uint64 Threads = 0);  ///< @see cschc(complex64)
+void __cdecl arsinhc(std::span<const complex64> _X, std::span<complex64> _Out, int _N = 0, int64 _K = 0, uint64 Threads = 0); ///< @see arsinhc(complex64, int, int64)
+void __cdecl arcoshc(std::span<const complex64> _X, std::span<complex64> _Out, int _N = 0, int64 _K = 0, uint64 Threads = 0); ///< @see arcoshc(complex64, int, int64)
+void __cdecl artanhc(std::span<const complex64> _X, std::span<complex64> _Out, int64 _K = 0, uint64 Threads = 0);             ///< @see artanhc(complex64, int64)
+void __cdecl arcothc(std::span<const complex64> _X, std::span<complex64> _Out, int64 _K = 0, uint64 Threads = 0);             ///< @see arcothc(complex64, int64)
+void __cdecl arsechc(std::span<const complex64> _X, std::span<complex64> _Out, int _N = 0, int64 _K = 0, uint64 Threads = 0); ///< @see arsechc(complex64, int, int64)
+void __cdecl arcschc(std::span<const complex64> _X, std::span<complex64> _Out, int _N = 0, int64 _K = 0, uint64 Threads = 0); ///< @see arcschc(complex64, int, int64)
+/// @}
+
 /**@}*/
\ No newline at end of file
@@ -180,6 +180,14 @@ public:
      * @param[in] JD 儒略日数值
      */
     virtual void SetDate(float64 JD) = 0;
+
+    /**
+     * @brief 设置内部日期为指定的历元
+     * @param[in] Epoch 目标历元
+     * @details 默认实现转换为儒略日后调用 SetDate(float64)，只为尚未专门实现的跟踪器提供兼容；
+     *          频繁设置日期的跟踪器应重写此函数，直接使用整数计数计算时间差。
+     */
+    virtual void SetDate(CSEEpoch Epoch);
     
     /**
      * @brief 移动
@@ -268,6 +276,7 @@ protected:
     BaseType InitialState;   ///< 初始轨道状态
     BaseType CurrentState;   ///< 当前轨道状态
     Angle    AngularVelocity; ///< 角速度
+    CSEEpoch InitialEpoch;   ///< 初始状态历元，构造时由 InitialState.Epoch 转换一次得到
 
     /**
      * @brief 检查轨道参数有效性
@@ -299,6 +308,16 @@ public:
     void ToCurrentDate()override;
     void SetDate(CSEDateTime DateTime)override;
     void SetDate(float64 JD)override;
+
+    /**
+     * @brief 设置内部日期为指定的历元
+     * @param[in] Epoch 目标历元
+     * @details 目标历元与 InitialEpoch 之差先以整数微秒计算，再一次转换为秒乘以角速度得到平近点角的增量，
+     *          不会因两个相近的大儒略日相减而损失精度。InitialState.Epoch 本身是儒略日，
+     *          构造时转换为 InitialEpoch 会舍入到微秒，这一固定偏差不随目标历元变化。
+     */
+    void SetDate(CSEEpoch Epoch)override;
+
     void Move(Angle MeanAnomalyOffset)override;
     void Reset()override;
 
@@ -309,6 +328,8 @@ public:
      * @brief 获取轨道状态向量
      * @param[in] AxisMapper 坐标轴映射矩阵，默认为标准映射
      * @return 轨道状态向量
+     * @details 方向余弦矩阵需要升交点经度、轨道倾角和近心点辐角的正弦和余弦，椭圆轨道还需要偏近点角的正弦和余弦，
+     *          这些都用 sincos(Angle, float64*, float64*) 成对计算。
      */
     OrbitStateVectors StateVectors(mat3 AxisMapper = ECIFrameToCSECoord)const override;
 
@@ -329,6 +350,7 @@ public:
  */
 class EquinoctialSatelliteTracker : public SatelliteTracker
 {
+public:
     // TODO...
 };
 
@@ -638,6 +660,7 @@ public:
             CSEDateTime  StopTime;             ///< 数据结束时间
             std::string  Interpolation;        ///< 插值方法
             uint64       InterpolaDegrees = 0; ///< 插值阶数
+            float64      GravParam = _NoDataDbl; ///< 中心天体的引力参数 (米³/秒²)，OEM元数据中没有此项，由调用方根据CenterName填写，插值结果中原样返回
         };
         
         MetadataType MetaData;  ///< 元数据实例
@@ -647,7 +670,7 @@ public:
          */
         struct EphemerisType
         {
-            CSEDateTime  Epoch;        ///< 历元时间
+            CSEEpoch     Epoch;        ///< 历元时间，导入时由日期时间转换得到，插值时用于二分查找
             vec3         Position;     ///< 位置矢量 (km)
             vec3         Velocity;     ///< 速度矢量 (km/s)
             vec3         Acceleration; ///< 加速度矢量 (km/s²)
@@ -660,7 +683,7 @@ public:
          */
         struct CovarianceMatrixType
         {
-            CSEDateTime  Epoch;        ///< 历元时间
+            CSEEpoch     Epoch;        ///< 历元时间
             std::string  RefFrame;     ///< 参考坐标系
             matrix<6, 6> Data;         ///< 6x6协方差矩阵数据
         };
@@ -847,6 +870,45 @@ public:
      * @todo 待实现
      */
     OrbitStateVectors operator()(CSEDateTime time);
+
+    /**
+     * @brief 根据历元计算轨道状态向量
+     * @param time 历元，时间尺度与数据段的TimeSystem相同
+     * @return 轨道状态向量，位置和速度换算为米和米/秒
+     * @details 依次在各数据段中查找，见 __Interpolate_Segment。
+     * @throws std::logic_error 历元不在任何数据段的范围内
+     */
+    OrbitStateVectors operator()(CSEEpoch time)const
+    {
+        for (const auto& Segment : Data)
+        {
+            auto Result = __Interpolate_Segment(Segment, time);
+            if (Result) {return *Result;}
+        }
+        throw std::logic_error("Epoch is out of range of the ephemeris.");
+    }
+
+    /**
+     * @brief 根据指定时间尺度的历元计算轨道状态向量
+     * @param time 历元
+     * @param Scale 历元所在的时间尺度
+     * @param Converter 时间尺度转换器
+     * @return 轨道状态向量，位置和速度换算为米和米/秒
+     * @details 对每个数据段，先用 Converter 将历元转换到该段元数据中 TimeSystem 所指的时间尺度，再按 __Interpolate_Segment 插值。
+     *          例如以UTC查询以TDB给出的星历时，会依次计入闰秒、32.184秒和TDB-TT周期项。返回值的Time为转换后的儒略日。
+     * @throws std::logic_error 元数据中的时间系统不受支持，或历元不在任何数据段的范围内
+     */
+    OrbitStateVectors operator()(CSEEpoch time, TimeScale Scale,
+        const TimeScaleConverter& Converter = TimeScaleConverter())const
+    {
+        for (const auto& Segment : Data)
+        {
+            CSEEpoch Local = Converter.Convert(time, Scale, ParseTimeScale(Segment.MetaData.TimeSystem));
+            auto Result = __Interpolate_Segment(Segment, Local);
+            if (Result) {return *Result;}
+        }
+        throw std::logic_error("Epoch is out of range of the ephemeris.");
+    }
     
     /**
      * @brief 根据时间偏移计算轨道状态向量
@@ -856,6 +918,71 @@ public:
      */
     OrbitStateVectors operator()(float64 timeOffset);
     /// @}
+
+protected:
+    /**
+     * @brief 在一个数据段内插值
+     * @param Segment 数据段
+     * @param time 历元
+     * @return 轨道状态向量，历元不在数据段范围内时为空
+     * @details 数据段的范围为星历首末两条记录之间；元数据中给出了 UseableStartTime 或 UseableStopTime 时，范围再裁剪到有效时间内。
+     *          按CCSDS OEM的约定，有效时间以外的记录只用于支撑插值，相邻的数据段（如机动前后）以各自的有效时间分界，
+     *          因此有效时间以外的历元交给下一个数据段处理，但区间内插值时仍使用这些记录。
+     *          结果的参考系取元数据的 RefFrame，引力参数取元数据的 GravParam。
+     *
+     * 在按历元升序排列的星历上用二分查找确定所在区间，两端点的位置和速度确定一条三次Hermite曲线：
+     * \f[
+     * \mathbf{r}(s)=h_{00}(s)\mathbf{r}_0+h_{10}(s)\Delta t\,\mathbf{v}_0+h_{01}(s)\mathbf{r}_1+h_{11}(s)\Delta t\,\mathbf{v}_1,\quad s=\frac{t-t_0}{\Delta t}
+     * \f]
+     * 速度为上式对t求导。历元之差以整数微秒计算，不进行历法计算。元数据中的插值方法和阶数目前不使用。
+     */
+    static std::optional<OrbitStateVectors> __Interpolate_Segment(const ValueType& Segment, CSEEpoch time)
+    {
+        using EphemerisType = ValueType::EphemerisType;
+        const auto& Eph = Segment.Ephemeris;
+        if (Eph.empty()) {return std::nullopt;}
+        CSEEpoch Lo = Eph.front().Epoch, Hi = Eph.back().Epoch;
+        if (Segment.MetaData.UseableStartTime.IsValid())
+        {
+            Lo = std::max(Lo, CSEEpoch::FromDateTime(Segment.MetaData.UseableStartTime));
+        }
+        if (Segment.MetaData.UseableStopTime.IsValid())
+        {
+            Hi = std::min(Hi, CSEEpoch::FromDateTime(Segment.MetaData.UseableStopTime));
+        }
+        if (time < Lo || Hi < time) {return std::nullopt;}
+
+        OrbitStateVectors Result;
+        Result.RefPlane  = ustring(Segment.MetaData.RefFrame);
+        Result.GravParam = Segment.MetaData.GravParam;
+        Result.Time = time.ToJulianDay();
+        if (Eph.size() == 1)
+        {
+            Result.Position = Eph.front().Position * 1000.;
+            Result.Velocity = Eph.front().Velocity * 1000.;
+            return Result;
+        }
+
+        auto Next = std::upper_bound(Eph.begin(), Eph.end(), time,
+            [](CSEEpoch t, const EphemerisType& e) {return t < e.Epoch;});
+        if (Next == Eph.end()) {--Next;}
+        auto Prev = Next - 1;
+
+        float64 dt = float64(Next->Epoch.Count() - Prev->Epoch.Count()) / CSEEpoch::TicksPerSecond;
+        float64 s  = float64(time.Count() - Prev->Epoch.Count()) / CSEEpoch::TicksPerSecond / dt;
+        float64 s2 = s * s, s3 = s2 * s;
+
+        float64 h00 = 2. * s3 - 3. * s2 + 1., h10 = s3 - 2. * s2 + s;
+        float64 h01 = -2. * s3 + 3. * s2,     h11 = s3 - s2;
+        float64 d00 = 6. * s2 - 6. * s,       d10 = 3. * s2 - 4. * s + 1.;
+        float64 d01 = -6. * s2 + 6. * s,      d11 = 3. * s2 - 2. * s;
+
+        Result.Position = (Prev->Position * h00 + Prev->Velocity * (h10 * dt)
+            + Next->Position * h01 + Next->Velocity * (h11 * dt)) * 1000.;
+        Result.Velocity = ((Prev->Position * d00 + Next->Position * d01) / dt
+            + Prev->Velocity * d10 + Next->Velocity * d11) * 1000.;
+        return Result;
+    }
 };
 ///@}
 
@@ -1667,11 +1794,354 @@ namespace PlanSim {
  * 
  * 丹霞：这里原本想搞一个行星推演的功能的，大概就是封装一堆物体的质量和初始状态，这个状态可以是状态向量或轨道根数，然后以时间为自变量可以获取到此时间点时这个系统中的物体的轨道根数。简单来说就是创建了一个连续的，系统中各个物体的状态与时间的函数。这个功能的实现可能可以从高斯摄动方程和拉格朗日行星运动方程去下手，当然网上也有一些用初等方式简单模拟的，但那种方法在短期模拟的表现可能好一些，但如果把时间线拉长可能会出现较多的精度丢失。
  *
- * @todo 实现具体功能
+ * @see __Mean_Elements_Planetary_Simulator
  */
 class __Planetary_Simulator
 {
-    // TODO: 实现具体功能
+public:
+    using BaseType = KeplerianOrbitElems; ///< 物体状态类型别名
+
+    virtual ~__Planetary_Simulator() = default;
+
+    /**
+     * @brief 向系统中加入一个物体
+     * @param[in] InitElems 物体的初始轨道根数，其历元必须与系统当前历元一致
+     * @return 物体在系统中的索引
+     */
+    virtual uint64 AddObject(const BaseType& InitElems) = 0;
+
+    /**
+     * @brief 获取系统中物体的数量
+     */
+    virtual uint64 Size()const = 0;
+
+    /**
+     * @brief 推进指定的秒数
+     * @param[in] Sec 要增加的秒数，可以为负数
+     */
+    virtual void AddSeconds(float64 Sec) = 0;
+
+    /**
+     * @brief 设置内部日期为指定的日期时间
+     * @param[in] DateTime 目标日期时间
+     */
+    virtual void SetDate(CSEDateTime DateTime) = 0;
+
+    /**
+     * @brief 设置内部日期为指定的儒略日
+     * @param[in] JD 目标儒略日
+     */
+    virtual void SetDate(float64 JD) = 0;
+
+    /**
+     * @brief 将系统重置为初始状态
+     */
+    virtual void Reset() = 0;
+
+    /**
+     * @brief 获取指定物体在当前时刻的轨道根数
+     * @param[in] Index 物体索引
+     * @return 当前时刻的轨道根数
+     */
+    virtual BaseType KeplerianElems(uint64 Index)const = 0;
+};
+
+/**
+ * @defgroup SecularPerturbation 长期摄动源
+ * @ingroup PlanSimulation
+ * @brief 用于平根数推演的摄动源
+ * @details
+ * 平根数推演只关心摄动在一个轨道周期内的平均效果，也就是把摄动对轨道根数的影响按平近点角积分一圈后除以周期，
+ * 这样短周期项就被消去了，只剩下长期项和长周期项。由于平均后的变化率随时间变化得很慢，推演时的步长可以取到数天甚至数十天，
+ * 这也是它比直接积分状态向量快得多的原因。
+ * @{
+ */
+
+/**
+ * @struct MeanElemsRates
+ * @brief 平根数的长期变化率
+ * @note 平近点角的变化率不包含平运动n，平运动由推演器根据半长轴自行计算。
+ */
+struct MeanElemsRates
+{
+    float64   SemiMajorAxis   = 0;   ///< 半长轴变化率 (米/秒)
+    float64   Eccentricity    = 0;   ///< 离心率变化率 (1/秒)
+    float64   Inclination     = 0;   ///< 轨道倾角变化率 (度/秒)
+    float64   AscendingNode   = 0;   ///< 升交点赤经变化率 (度/秒)
+    float64   ArgOfPericenter = 0;   ///< 近心点幅角变化率 (度/秒)
+    float64   MeanAnomaly     = 0;   ///< 平近点角变化率，不含平运动 (度/秒)
+
+    /**
+     * @brief 变化率叠加，用于合并多个摄动源的贡献
+     */
+    MeanElemsRates& operator+=(const MeanElemsRates& Right) noexcept;
+};
+
+/**
+ * @struct PerturbedBody
+ * @brief 被摄动物体自身的参数
+ * @details 与轨道无关、但因物体而异的摄动参数，由推演器按物体分别保存。
+ */
+struct PerturbedBody
+{
+    float64 BallisticCoeff = _NoDataDbl; ///< 弹道系数C_D*A/m (平方米/千克)，无效时不受大气阻力
+};
+
+/**
+ * @struct PerturbationSource
+ * @brief 长期摄动源接口
+ */
+struct PerturbationSource
+{
+    virtual ~PerturbationSource() = default;
+
+    /**
+     * @brief 摄动是否为保守力
+     * @details 保守力摄动可以写成摄动势的形式，从而可以用拉格朗日行星运动方程处理；非保守力摄动只能用高斯摄动方程处理。
+     */
+    virtual bool IsConservative()const = 0;
+
+    /**
+     * @brief 摄动是否保持轨道形状
+     * @details 为真时表示对任意平根数，此摄动源给出的半长轴、离心率和倾角的长期变化率恒为0，
+     *          即\f$\dot a = \dot e = \dot i = 0\f$，例如J2项。
+     */
+    virtual bool PreservesShape()const = 0;
+
+    /**
+     * @brief 计算给定平根数下的长期变化率
+     * @param[in] MeanElems 平根数
+     * @param[in] Body 被摄动物体的参数
+     * @return 一个轨道周期内平均后的变化率
+     */
+    virtual MeanElemsRates SecularRates(const KeplerianOrbitElems& MeanElems, const PerturbedBody& Body)const = 0;
+};
+
+/// @brief 摄动源指针类型
+using PerturbationPtr = std::shared_ptr<PerturbationSource>;
+
+/**
+ * @class OblatenessPerturbation
+ * @brief 中心天体扁率（J2项）摄动
+ * @details
+ * J2项摄动对应的平均摄动势只与a、e、i有关，因此代入拉格朗日行星运动方程后半长轴、离心率和倾角均不发生长期变化，
+ * 只有升交点、近心点幅角和平近点角存在长期项[1]：
+ * \f[\dot\Omega = -\frac{3}{2}nJ_2\left(\frac{R}{p}\right)^2\cos i\f]
+ * \f[\dot\omega = \frac{3}{4}nJ_2\left(\frac{R}{p}\right)^2(5\cos^2 i - 1)\f]
+ * \f[\dot M - n = \frac{3}{4}nJ_2\left(\frac{R}{p}\right)^2\sqrt{1-e^2}(3\cos^2 i - 1)\f]
+ * 其中R为中心天体的赤道半径，倾角以中心天体的赤道面为参考平面。
+ *
+ * 若中心天体只有扁率和自转周期，可以用一阶近似由扁率f估算J2[2]：
+ * \f[J_2 \approx \frac{2f - q}{3}, \quad q = \frac{\omega^2R^3}{GM}\f]
+ *
+ * @par 参考文献
+ * [1] Vallado D A. Fundamentals of Astrodynamics and Applications[M]. 4th ed. Microcosm Press, 2013: 647-652.<br>
+ * [2] Murray C D, Dermott S F. Solar System Dynamics[M]. Cambridge University Press, 1999: 157-159.<br>
+ */
+class OblatenessPerturbation : public PerturbationSource
+{
+public:
+    float64 J2               = _NoDataDbl; ///< 二阶带谐系数
+    float64 EquatorialRadius = _NoDataDbl; ///< 中心天体赤道半径 (米)
+
+    /**
+     * @brief 构造函数
+     * @param[in] J2 二阶带谐系数
+     * @param[in] EquatorialRadius 中心天体赤道半径 (米)
+     */
+    OblatenessPerturbation(float64 J2, float64 EquatorialRadius);
+
+    /**
+     * @brief 由中心天体的扁率和自转周期估算J2并构造摄动源
+     * @param[in] Primary 中心天体，其质量、半径(Dimensions)和自转周期必须有效
+     * @throws std::logic_error 中心天体参数无效时抛出
+     */
+    static OblatenessPerturbation FromObject(const Object& Primary);
+
+    bool IsConservative()const override;
+    bool PreservesShape()const override;
+    MeanElemsRates SecularRates(const KeplerianOrbitElems& MeanElems, const PerturbedBody& Body)const override;
+};
+
+/**
+ * @class AtmosphericDragPerturbation
+ * @brief 大气阻力摄动
+ * @details
+ * 大气密度采用指数模型 \f$\rho(h) = \rho_0\exp(-(h-h_0)/H)\f$，忽略大气随中心天体的旋转。
+ * 阻力是非保守力，只能通过高斯摄动方程计算。将高斯摄动方程对偏近点角E积分一圈，
+ * 可以得到每圈半长轴和离心率的变化量[1]：
+ * \f[\Delta a = -\delta a^2\int_0^{2\pi}\rho\frac{(1+e\cos E)^{3/2}}{(1-e\cos E)^{1/2}}dE\f]
+ * \f[\Delta e = -\delta a(1-e^2)\int_0^{2\pi}\rho\left(\frac{1+e\cos E}{1-e\cos E}\right)^{1/2}\cos E\,dE\f]
+ * 其中\f$\delta = C_DA/m\f$为弹道系数，取自 PerturbedBody::BallisticCoeff，因此同一个摄动源可以作用于弹道系数不同的多颗卫星。
+ * 积分使用高斯-勒让德求积，变化率即为每圈变化量除以轨道周期。
+ *
+ * @par 参考文献
+ * [1] King-Hele D. Theory of Satellite Orbits in an Atmosphere[M]. Butterworths, 1964: 40-48.<br>
+ */
+class AtmosphericDragPerturbation : public PerturbationSource
+{
+public:
+    float64 BodyRadius     = _NoDataDbl; ///< 中心天体半径 (米)
+    float64 RefDensity     = _NoDataDbl; ///< 参考高度处的大气密度 (千克/立方米)
+    float64 RefAltitude    = _NoDataDbl; ///< 参考高度 (米)
+    float64 ScaleHeight    = _NoDataDbl; ///< 大气标高 (米)
+    uint64  QuadratureNodes = 16;        ///< 求积节点数
+
+    /**
+     * @brief 构造函数
+     * @param[in] BodyRadius 中心天体半径 (米)
+     * @param[in] RefDensity 参考高度处的大气密度 (千克/立方米)
+     * @param[in] RefAltitude 参考高度 (米)
+     * @param[in] ScaleHeight 大气标高 (米)
+     */
+    AtmosphericDragPerturbation(float64 BodyRadius, float64 RefDensity,
+        float64 RefAltitude, float64 ScaleHeight);
+
+    bool IsConservative()const override;
+    bool PreservesShape()const override;
+    MeanElemsRates SecularRates(const KeplerianOrbitElems& MeanElems, const PerturbedBody& Body)const override;
+};
+
+/**
+ * @class ThirdBodyPerturbation
+ * @brief 第三体引力摄动
+ * @details
+ * 摄动体视为在固定椭圆轨道上运动的质点，对被摄动物体和摄动体的平近点角分别平均后，
+ * 保留到四极矩项的平均摄动势为[1]：
+ * \f[\bar R = \frac{\mu' a^2}{8a'^3(1-e'^2)^{3/2}}\left[(2+3e^2)(3\cos^2 i-1) + 15e^2\sin^2 i\cos 2\omega\right]\f]
+ * 其中带撇号的量属于摄动体，倾角和近心点幅角均相对于摄动体的轨道平面。将其代入拉格朗日行星运动方程即可得到变化率，
+ * 计算前后会在参考平面和摄动体轨道平面之间做一次旋转变换。此项即为古在-利多夫（Kozai-Lidov）机制的来源。
+ *
+ * @note 要求被摄动物体的半长轴远小于摄动体的半长轴，否则四极矩近似失效。
+ *
+ * @par 参考文献
+ * [1] Naoz S. The Eccentric Kozai-Lidov Effect and Its Applications[J]. Annual Review of Astronomy and Astrophysics, 2016, 54: 441-489.<br>
+ */
+class ThirdBodyPerturbation : public PerturbationSource
+{
+public:
+    float64 GravParam = _NoDataDbl;  ///< 摄动体引力参数(G*M)
+    KeplerianOrbitElems Orbit;       ///< 摄动体相对于中心天体的轨道
+
+    /**
+     * @brief 构造函数
+     * @param[in] GravParam 摄动体引力参数(G*M)
+     * @param[in] Orbit 摄动体相对于中心天体的轨道，参考平面须与被摄动物体一致
+     */
+    ThirdBodyPerturbation(float64 GravParam, const KeplerianOrbitElems& Orbit);
+
+    bool IsConservative()const override;
+    bool PreservesShape()const override;
+    MeanElemsRates SecularRates(const KeplerianOrbitElems& MeanElems, const PerturbedBody& Body)const override;
+};
+
+/**@}*/
+
+/**
+ * @class __Mean_Elements_Planetary_Simulator
+ * @ingroup PlanSimulation
+ * @brief 平根数推演器基类
+ * @details
+ * 高斯摄动方程和拉格朗日行星运动方程推演器的公共部分。系统中所有物体共用同一组摄动源和同一个当前历元，
+ * 弹道系数等因物体而异的参数则按物体保存在 Bodies 中，计算变化率时传给摄动源。
+ * 物体的平根数按分量连续存储（半长轴、离心率等各占一个数组），推演时对所有物体逐步使用定步长四阶龙格库塔法积分，
+ * 因此一次推进的开销与物体数量成线性关系，适合成千上万颗卫星的星座长期演化研究。
+ *
+ * 步长的选取只需要满足摄动的长期项在一步内变化不大，对于近地卫星的J2与阻力摄动，一般取1天即可；
+ * 对于古在-利多夫振荡，步长取振荡周期的百分之一左右即可。
+ */
+class __Mean_Elements_Planetary_Simulator : public __Planetary_Simulator
+{
+public:
+    using Mybase   = __Planetary_Simulator;  ///< 基类类型别名
+    using BaseType = KeplerianOrbitElems;    ///< 基础数据类型别名
+
+protected:
+    float64 StepSize;                        ///< 积分步长 (秒)
+    float64 InitialEpoch = _NoDataDbl;       ///< 初始历元 (儒略日)
+    float64 CurrentEpoch = _NoDataDbl;       ///< 当前历元 (儒略日)
+    std::vector<PerturbationPtr> Perturbations; ///< 摄动源
+
+    std::vector<BaseType> InitialStates;     ///< 所有物体的初始轨道根数
+    std::vector<float64>  GravParam;         ///< 引力参数
+    std::vector<float64>  SemiMajorAxis;     ///< 半长轴 (米)
+    std::vector<float64>  Eccentricity;      ///< 离心率
+    std::vector<float64>  Inclination;       ///< 轨道倾角 (度)
+    std::vector<float64>  AscendingNode;     ///< 升交点赤经 (度)
+    std::vector<float64>  ArgOfPericenter;   ///< 近心点幅角 (度)
+    std::vector<float64>  MeanAnomaly;       ///< 平近点角 (度)
+    std::vector<PerturbedBody> Bodies;       ///< 各物体自身的摄动参数
+
+    /**
+     * @brief 组装指定物体的当前平根数
+     */
+    BaseType __Get_Mean_Elems(uint64 Index)const;
+
+    /**
+     * @brief 计算物体的长期变化率，由派生类决定如何合并摄动源
+     * @param[in] MeanElems 平根数
+     * @param[in] Body 物体自身的摄动参数
+     */
+    virtual MeanElemsRates __Secular_Rates(const BaseType& MeanElems, const PerturbedBody& Body)const = 0;
+
+    /**
+     * @brief 将所有物体推进一个不超过步长的时间
+     * @param[in] Sec 推进的秒数
+     */
+    virtual void __Step(float64 Sec);
+
+public:
+    /**
+     * @brief 构造函数
+     * @param[in] Epoch 系统的初始历元 (儒略日)
+     * @param[in] StepSize 积分步长 (秒)，默认1天
+     */
+    explicit __Mean_Elements_Planetary_Simulator(float64 Epoch, float64 StepSize = 86400.);
+
+    /**
+     * @brief 添加一个摄动源
+     * @param[in] Source 摄动源
+     */
+    virtual void AddPerturbation(PerturbationPtr Source);
+
+    uint64 AddObject(const BaseType& InitElems)override;
+
+    /**
+     * @brief 添加一个物体并指定其摄动参数
+     * @param[in] InitElems 初始轨道根数
+     * @param[in] Body 物体自身的摄动参数，如弹道系数
+     * @return 物体在系统中的索引
+     */
+    uint64 AddObject(const BaseType& InitElems, const PerturbedBody& Body);
+
+    /**
+     * @brief 批量添加物体
+     * @param[in] InitElems 所有物体的初始轨道根数
+     * @param[in] Bodies 各物体自身的摄动参数，为空时全部使用默认值，否则长度须与InitElems相同
+     * @return 第一个物体在系统中的索引
+     * @throws std::logic_error Bodies的长度与InitElems不同时抛出
+     */
+    uint64 AddObjects(const std::vector<BaseType>& InitElems, const std::vector<PerturbedBody>& Bodies = {});
+
+    uint64 Size()const override;
+
+    void AddSeconds(float64 Sec)override;
+    void SetDate(CSEDateTime DateTime)override;
+    void SetDate(float64 JD)override;
+    void Reset()override;
+
+    BaseType KeplerianElems(uint64 Index)const override;
+
+    /**
+     * @brief 获取所有物体在当前时刻的轨道根数
+     */
+    std::vector<BaseType> KeplerianElems()const;
+
+    /**
+     * @brief 获取指定物体在当前时刻的长期变化率
+     * @param[in] Index 物体索引
+     */
+    MeanElemsRates SecularRates(uint64 Index)const;
 };
 
 /**
@@ -1709,11 +2179,20 @@ class __Planetary_Simulator
  * - 纯径向摄动力不会改变轨道倾角；
  * - 纯法向摄动力不会直接改变轨道能量（半长轴）。
  *
- * @todo 实现高斯摄动方程相关功能
+ * 此推演器接受所有类型的摄动源，各摄动源的变化率直接相加，半长轴、离心率等全部六个根数均参与积分。
+ * 大气阻力等非保守力摄动只能使用此推演器。
  */
-class __Gauss_Perturbation_Planetary_Simulator : public __Planetary_Simulator
+class __Gauss_Perturbation_Planetary_Simulator : public __Mean_Elements_Planetary_Simulator
 {
-    // TODO: 实现高斯摄动方程相关功能
+public:
+    using Mybase   = __Mean_Elements_Planetary_Simulator; ///< 基类类型别名
+    using BaseType = KeplerianOrbitElems;                 ///< 基础数据类型别名
+
+protected:
+    MeanElemsRates __Secular_Rates(const BaseType& MeanElems, const PerturbedBody& Body)const override;
+
+public:
+    using Mybase::Mybase;
 };
 
 /**
@@ -1740,14 +2219,78 @@ class __Gauss_Perturbation_Planetary_Simulator : public __Planetary_Simulator
  *
  * 从以上定义可以看出，方程的右边也是没有直接含t的，这同样意味着需要用各轨道根数与摄动势和时间建立函数关系，带入上述定义后才能用微分方程求解器（如龙格库塔算法）求解。
  *
+ * 此推演器只接受保守力摄动源。由于平均后的摄动势不含平近点角，半长轴不发生长期变化，平运动在整个推演过程中保持不变，
+ * 因此只对其余五个根数积分。当所有摄动源的 PerturbationSource::PreservesShape() 都为真时（即\f$\dot a = \dot e = \dot i = 0\f$，例如只有J2项），
+ * a、e、i保持不变，而升交点、近心点幅角和平近点角的变化率只依赖于这三个根数，因此也是常量，
+ * 此时直接按变化率解析外推，推进任意时长都只需一步。是否满足此条件在添加摄动源时检查并记录在 AnalyticPropagation 中。
+ * AnalyticPropagation 为真时，AddSeconds 和 SetDate 不再按 StepSize 分段，而是对整个时间间隔调用一次 __Step；否则使用基类的分段积分。
+ *
  * @note 「拉格朗日方程是轨道摄动分析的瑰宝，它将复杂的摄动效应凝练为优雅的数学形式，使我们能够透过纷繁的表象，洞察摄动的本质。」
- * @todo 实现拉格朗日行星运动方程相关功能
  */
-class __Lagrange_Planetary_Simulator : public __Planetary_Simulator
+class __Lagrange_Planetary_Simulator : public __Mean_Elements_Planetary_Simulator
 {
-    // TODO: 实现拉格朗日行星运动方程相关功能
+public:
+    using Mybase   = __Mean_Elements_Planetary_Simulator; ///< 基类类型别名
+    using BaseType = KeplerianOrbitElems;                 ///< 基础数据类型别名
+
+protected:
+    bool AnalyticPropagation = true; ///< 所有摄动源均保持轨道形状，可以解析外推
+
+    MeanElemsRates __Secular_Rates(const BaseType& MeanElems, const PerturbedBody& Body)const override;
+
+    /**
+     * @brief 将所有物体推进指定的时间
+     * @param[in] Sec 推进的秒数，AnalyticPropagation 为真时可以为任意长度，否则不超过步长
+     */
+    void __Step(float64 Sec)override;
+
+public:
+    using Mybase::Mybase;
+
+    /**
+     * @brief 推进指定的秒数
+     * @param[in] Sec 秒数，可以为负数
+     * @details AnalyticPropagation 为真时只调用一次 __Step 解析外推，否则按步长分段积分。
+     */
+    void AddSeconds(float64 Sec)override;
+
+    /**
+     * @brief 设置当前日期
+     * @param[in] DateTime 目标日期时间
+     * @details 与 SetDate(float64) 相同。
+     */
+    void SetDate(CSEDateTime DateTime)override;
+
+    /**
+     * @brief 设置当前日期
+     * @param[in] JD 目标儒略日
+     * @details AnalyticPropagation 为真时从初始历元解析外推一步到目标日期，否则从初始历元按步长分段积分。
+     */
+    void SetDate(float64 JD)override;
+
+    /**
+     * @brief 添加一个摄动源
+     * @param[in] Source 摄动源，必须为保守力摄动
+     * @throws std::logic_error 摄动源为非保守力时抛出
+     * @details 摄动源的 PreservesShape() 为假时清除 AnalyticPropagation，之后改用数值积分。
+     */
+    void AddPerturbation(PerturbationPtr Source)override;
 };
 
+/**
+ * @brief 计算物体的升交点和近心点幅角进动周期并写入其轨道参数
+ * @details 以物体当前的轨道根数作为平根数，由摄动源的长期变化率计算进动周期：
+ * \f[T_\Omega = \frac{360^\circ}{\dot\Omega}, \quad T_\omega = \frac{360^\circ}{\dot\omega}\f]
+ * 结果分别写入 `Object::OrbitParams::AscNodePreces` 和 `Object::OrbitParams::ArgOfPeriPreces`，
+ * 进动方向与变化率的符号相同。变化率为0时对应的字段保持不变。
+ * @param[in,out] Obj 指向物体的指针，其 `.Orbit` 必须有效
+ * @param[in] Perturbations 作用于该物体的摄动源
+ * @param[in] Body 物体自身的摄动参数，默认不受大气阻力
+ * @throws std::logic_error 物体的轨道参数无效时抛出
+ */
+void __cdecl MakePrecession(Object* Obj, const std::vector<PerturbationPtr>& Perturbations,
+    const PerturbedBody& Body = PerturbedBody());
+
 /**
  * @page symplectic_geom 后续的一些研究记录
  * @ingroup PlanSimulation
@@ -1806,6 +2349,36 @@ public:
     mat3    AxisMapper    = Orbit::CSECoordToECIFrame;    ///< 坐标系转换矩阵：CSE坐标 -> ECI框架
     mat3    InvAxisMapper = Orbit::ECIFrameToCSECoord;    ///< 坐标系逆转换矩阵：ECI框架 -> CSE坐标
 
+    /**
+     * @brief 等势面三角网格
+     */
+    struct EquipotentialMesh
+    {
+        std::vector<vec3>                    Vertices;  ///< 顶点坐标（物理坐标，已经过AxisMapper变换）
+        std::vector<vec3>                    Normals;   ///< 顶点法线，取势函数梯度的反方向并归一化
+        std::vector<std::array<uint32_t, 3>> Triangles; ///< 三角形顶点索引，逆时针为外侧
+        float64                              Volume = 0; ///< 网格包围的体积（物理单位）
+    };
+
+    /**
+     * @brief 网格提取方法
+     */
+    enum MeshingMethod : uint8_t
+    {
+        MarchingCubes = 0, ///< 移动立方体法，适用于任意势值，包括共有包层
+        SphericalRays = 1  ///< 球面射线求根法，只适用于星形等势面，但网格更规则，速度更快
+    };
+
+    /**
+     * @brief 网格提取对象
+     */
+    enum LobeSelection : uint8_t
+    {
+        PrimaryLobe   = 1,  ///< 主星
+        CompanionLobe = 2,  ///< 伴星
+        BothLobes     = 3   ///< 两个星体，势值低于L1点势值时为共有包层
+    };
+
 protected:
     /**
      * @brief 计算归一化势函数值
@@ -1911,6 +2484,29 @@ protected:
      */
     std::array<vec3, 5> __Lagrange_Point_Impl(const SolvePolyRoutine& Routine)const;
 
+    /**
+     * @brief 使用专用迭代计算三个共线拉格朗日点
+     * @param Mu 质量参数 \f$ \mu = \frac{M_2}{M_1+M_2} \f$
+     * @param L1 输出L1点到伴星的距离（以Separation为单位）
+     * @param L2 输出L2点到伴星的距离（以Separation为单位）
+     * @param L3 输出L3点到主星的距离（以Separation为单位）
+     *
+     * 直接对 __Lagrange_Point_Impl 中列出的三个五次方程求唯一的正实根，不构造系数和根数组，也不求其余复根。
+     * 初值取希尔半径 \f$ r_H = (\mu/3)^{1/3} \f$ 的级数展开[1]：
+     * \f[
+     * \gamma_1 \approx r_H\left(1 - \frac{r_H}{3} - \frac{r_H^2}{9}\right), \quad
+     * \gamma_2 \approx r_H\left(1 + \frac{r_H}{3} - \frac{r_H^2}{9}\right), \quad
+     * \gamma_3 \approx 1 - \frac{7}{12}\mu
+     * \f]
+     * 之后使用带区间保护的牛顿迭代（迭代点越出根所在区间时退化为二分），对于任意 \f$ 0<\mu<1 \f$
+     * 一般3~5次迭代即可收敛到相对误差 \f$ 10^{-15} \f$ 以内。μ较大时级数初值变差，但区间保护保证了收敛。
+     *
+     * @par 参考文献
+     * [1] Murray C D, Dermott S F. Solar System Dynamics[M]. Cambridge University Press, 1999: 83-86.<br>
+     */
+    static void __Collinear_Lagrange_Point_Impl(float64 Mu,
+        float64* L1, float64* L2, float64* L3)noexcept;
+
     /**
      * @brief 计算等势面关键尺寸
      * @param PotentialOffset 势函数偏移量（相对于L1点势值）
@@ -1948,6 +2544,50 @@ protected:
     std::array<vec3, 20> __Equipotential_Dimensions_Impl(float64 PotentialOffset,
         const SolvePolyRoutine& SPRoutine)const;
 
+    /**
+     * @brief 批量计算归一化势函数值
+     * @param X 归一化X坐标数组
+     * @param Y 归一化Y坐标数组
+     * @param Z 归一化Z坐标数组
+     * @param Out 输出的归一化势函数值数组
+     * @param Count 点的数量
+     *
+     * 与 __Dimensionless_Potential_Impl 公式相同，坐标按分量分开存储，
+     * 以便编译器对循环进行向量化。两个距离的倒数共用一次平方根倒数计算。
+     */
+    void __Dimensionless_Potential_Batch_Impl(const float64* X, const float64* Y,
+        const float64* Z, float64* Out, uint64 Count)const;
+
+    /**
+     * @brief 使用移动立方体法提取等势面
+     * @param Potential 归一化势值
+     * @param Lobe 需要提取的星体
+     * @param Resolution 每个轴上的采样数
+     * @param Threads 工作线程数，为0时自动选择
+     * @param SPRoutine 多项式求解器例程，用于确定采样范围
+     *
+     * 采样范围取等势面关键尺寸(__Equipotential_Dimensions_Impl)的包围盒。网格按Z方向分层，
+     * 每个线程负责若干层，层内逐行调用 __Dimensionless_Potential_Batch_Impl 采样后直接生成三角形，
+     * 相邻线程共享的边界层顶点在合并时去重。顶点位置在棱上线性插值后再用一次牛顿迭代修正到等势面上。
+     */
+    EquipotentialMesh __Marching_Cubes_Impl(float64 Potential, uint8_t Lobe,
+        uint64 Resolution, uint64 Threads, const SolvePolyRoutine& SPRoutine)const;
+
+    /**
+     * @brief 使用球面射线求根法提取等势面
+     * @param Potential 归一化势值
+     * @param Lobe 需要提取的星体，不能同时选择两个星体
+     * @param Resolution 经线方向的采样数，纬线方向取其一半
+     * @param Threads 工作线程数，为0时自动选择
+     *
+     * 从星体中心沿经纬网格方向发出射线，在[0, 洛希瓣内沿射线的最大半径]区间内用牛顿迭代求解
+     * \f$\Phi(r\hat{\mathbf{n}}) = \Phi_0\f$，以相邻纬线的解作为初值。
+     * 网格拓扑固定，因此三角形可以预先生成，只有半径需要计算。射线方向由经纬度的正弦和余弦批量算出，见 sincos(std::span<const float64>, std::span<float64>, std::span<float64>, uint64)。
+     * 此方法只适用于星形（从中心可见全部表面）的等势面，即势值不低于L1点势值的分离或半接触情形。
+     */
+    EquipotentialMesh __Spherical_Ray_Impl(float64 Potential, uint8_t Lobe,
+        uint64 Resolution, uint64 Threads)const;
+
 public:
     /**
      * @brief 计算质心位置
@@ -1968,6 +2608,17 @@ public:
      * @see __Dimensionless_Potential_Impl
      */
     float64 DimensionlessPotential(vec3 Pos)const;
+
+    /**
+     * @brief 批量计算归一化势函数
+     * @param Pos 物理位置坐标数组
+     * @param Threads 工作线程数，为0时自动选择
+     * @return std::vector<float64> 归一化势函数值数组
+     *
+     * @see __Dimensionless_Potential_Batch_Impl
+     */
+    std::vector<float64> DimensionlessPotential(const std::vector<vec3>& Pos,
+        uint64 Threads = 0)const;
     
     /**
      * @brief 计算物理势函数
@@ -2034,13 +2685,22 @@ public:
     
     /**
      * @brief 计算拉格朗日点位置
-     * @param Routine 多项式求解器例程（默认使用Durand-Kerner方法）
+     * @return std::array<vec3, 5> 拉格朗日点L1-L5的位置数组
+     * 
+     * 共线点使用专用迭代求解，不分配内存。
+     * 
+     * @see __Collinear_Lagrange_Point_Impl
+     */
+    std::array<vec3, 5> LagrangePoints()const;
+
+    /**
+     * @brief 使用通用多项式求解器计算拉格朗日点位置
+     * @param Routine 多项式求解器例程
      * @return std::array<vec3, 5> 拉格朗日点L1-L5的位置数组
      * 
      * @see __Lagrange_Point_Impl
      */
-    std::array<vec3, 5> LagrangePoints(
-        const SolvePolyRoutine& Routine = DurandKernerSolvePoly())const;
+    std::array<vec3, 5> LagrangePoints(const SolvePolyRoutine& Routine)const;
     
     /**
      * @brief 计算等势面尺寸
@@ -2052,6 +2712,32 @@ public:
      */
     std::array<vec3, 20> EquipotentialDimensions(float64 PotentialOffset = 0,
         const SolvePolyRoutine& SPRoutine = DurandKernerSolvePoly())const;
+
+    /**
+     * @brief 生成等势面三角网格
+     * @param PotentialOffset 势函数偏移量（相对于L1点势值）
+     * @param Lobe 需要提取的星体
+     * @param Resolution 采样分辨率，默认128
+     * @param Method 网格提取方法（默认使用移动立方体法）
+     * @param Threads 工作线程数，为0时自动选择
+     * @param SPRoutine 多项式求解器例程（默认使用Durand-Kerner方法）
+     * @return EquipotentialMesh 等势面网格及其包围的体积
+     *
+     * 体积由散度定理对闭合网格的三角形求和得到：
+     * \f[
+     * V = \frac{1}{6}\sum_{k}\mathbf{v}_{k,0}\cdot(\mathbf{v}_{k,1}\times\mathbf{v}_{k,2})
+     * \f]
+     * 对于移动立方体法，体积误差与分辨率的平方成反比；将结果与 CompanionEffectiveLobeRadius
+     * 对应的球体积比较可以用来检查分辨率是否足够。
+     *
+     * @throws std::logic_error 对球面射线求根法选择了BothLobes，或势值低于L1点势值时抛出
+     * @see __Marching_Cubes_Impl
+     * @see __Spherical_Ray_Impl
+     */
+    EquipotentialMesh EquipotentialSurface(float64 PotentialOffset = 0,
+        LobeSelection Lobe = BothLobes, uint64 Resolution = 128,
+        MeshingMethod Method = MarchingCubes, uint64 Threads = 0,
+        const SolvePolyRoutine& SPRoutine = DurandKernerSolvePoly())const;
     
     /**
      * @brief 计算物体物理尺寸对应的等势面
@@ -2145,6 +2831,189 @@ float64 ApproxHillSphere(float64 PrimaryMass, float64 CompanionMass, float64 Sep
 float64 HillSphere(float64 PrimaryMass, float64 CompanionMass, float64 Separation, 
                    const SolvePolyRoutine& SPRoutine);
 
+/**
+ * @brief 精确计算希尔球半径
+ * @param PrimaryMass 主星质量
+ * @param CompanionMass 伴星质量
+ * @param Separation 两星体间距
+ * @return float64 希尔球半径
+ * 
+ * 与上一个重载求解同一方程，但使用与 RocheLobe::LagrangePoints() 相同的专用迭代，不分配内存。
+ */
+float64 HillSphere(float64 PrimaryMass, float64 CompanionMass, float64 Separation);
+
+/**
+ * @brief 批量计算共线拉格朗日点
+ * @param MassRatios 质量比 \f$ q = M_2/M_1 \f$ 数组
+ * @param L1 输出L1点到伴星的距离数组（以间距为单位），可以为空指针
+ * @param L2 输出L2点到伴星的距离数组（以间距为单位），可以为空指针
+ * @param L3 输出L3点到主星的距离数组（以间距为单位），可以为空指针
+ * @param Count 数组长度
+ * 
+ * 用于扫描大量双星参数。所有数组由调用方分配，函数本身不分配内存，各元素的计算互不依赖。
+ * 结果与 RocheLobe::LagrangePoints(const SolvePolyRoutine&) 的结果在 \f$ 10^{-12} \f$ 的相对误差内一致。
+ * 
+ * @see RocheLobe::LagrangePoints()
+ */
+void __cdecl CollinearLagrangePoints(const float64* MassRatios, float64* L1,
+    float64* L2, float64* L3, uint64 Count)noexcept;
+
+/**
+ * @brief 洛希瓣半径和洛希极限的查表计算
+ * 
+ * 用于双星族群合成等需要在有限参数范围内进行海量计算的场合。RocheLobe 的有效瓣半径、RigidRocheLimit、
+ * FluidRocheLimit 和 ApproxHillSphere 每次计算都需要调用pow、cbrt或ln，此类在构造时预先对这些函数制表，
+ * 之后的计算只需要查表和一次三次多项式求值（FluidRocheLimit 的扁率因子除外，见下文）。此类需要显式构造和调用，原有函数的行为不受影响。
+ * 
+ * 制表方法：
+ * 1. 自变量（质量比或密度比）按倍程分段，每个倍程\f$ [2^e, 2^{e+1}) \f$内有N个等宽的区间，宽度\f$ h = 2^e/N \f$，即节点在尾数上等距分布。
+ *    查表时直接从IEEE-754浮点数的指数位得到倍程，从尾数高位得到区间索引，尾数的其余位就是区间内的相对位置，不需要调用对数函数；
+ * 2. 每个节点同时存储函数值和导数，区间内对x使用三次埃尔米特插值，插值余项满足
+ * \f[
+ * |E| \le \frac{h^4}{384}\max_{[x_k, x_{k+1}]}|f^{(4)}(x)|
+ * \f]
+ * 3. 误差上界由上式推导，而不是采样得到的：
+ *    - 立方根：\f$ |f^{(4)}(x)| = \frac{80}{81}x^{-11/3} \f$ 在区间左端点取最大值，而 \f$ f \f$ 在左端点取最小值，
+ *      代入\f$ x_k \ge 2^e \f$得到与倍程无关的相对误差上界\f$ \frac{80}{81}\cdot\frac{1}{384N^4} \f$；
+ *    - 有效瓣半径：在每个倍程的每个区间上对\f$ f^{(4)} \f$的解析表达式做区间算术，得到\f$ |f^{(4)}| \f$的严格上界，再除以区间上\f$ |f| \f$的下界。
+ *
+ *    构造时选取每倍程的区间数N，使上界不超过给定容差。MaxRelativeError() 返回的是此截断误差上界与插值求值的舍入误差（不超过4 ULP）之和。
+ * 
+ * 流体洛希极限的第二个立方根因子\f$ \sqrt[3]{\left(1+\frac{M_2}{3M_1} + \frac{f}{3}\left(1+\frac{M_2}{M_1}\right)\right)/(1-f)} \f$
+ * 同时依赖质量比和扁率，且扁率趋近1时没有上界，因此不制表，直接调用 cbrt。MaxRelativeError() 已计入这一因子：
+ * 对 FluidRocheLimit，上界再加上 cbrt 的1 ULP误差、求其自变量的4次运算的舍入和两因子相乘的舍入。
+ * 
+ * 超出制表范围的输入会退回到精确公式计算，因此误差上界对任意输入都成立。
+ * 批量接口分两遍处理：第一遍对所有元素查表，区间索引钳制在表内，没有分支，编译器可以将其向量化，同时记录超出范围的元素的下标；
+ * 第二遍只对这些元素用精确公式重新计算。输入全部在范围内时第二遍为空。
+ */
+class TabulatedRocheFunctions
+{
+public:
+    /**
+     * @brief 制表范围和精度
+     */
+    struct RangeType
+    {
+        float64 MassRatioMin    = 1E-4;   ///< 质量比下限
+        float64 MassRatioMax    = 1E+4;   ///< 质量比上限
+        float64 DensityRatioMin = 1E-3;   ///< 密度比下限
+        float64 DensityRatioMax = 1E+3;   ///< 密度比上限
+        float64 Tolerance       = 1E-10;  ///< 允许的最大相对误差
+    };
+
+protected:
+    RangeType            Range;             ///< 制表范围
+    uint64               LobeNodesPerOctave; ///< 瓣半径表每倍程的区间数，须为2的整数次幂，以便直接用尾数高位作索引
+    uint64               CbrtNodesPerOctave; ///< 立方根表每倍程的区间数，须为2的整数次幂
+    std::vector<float64> LobeTable;          ///< 瓣半径表，按(值, 导数)交错存储
+    std::vector<float64> DensityCbrtTable;   ///< 密度比的立方根表，范围为[DensityRatioMin, DensityRatioMax]，按(值, 导数)交错存储
+    std::vector<float64> HillCbrtTable;      ///< 希尔球的立方根表，按(值, 导数)交错存储
+    float64              HillArgMin;         ///< 希尔球立方根表的下限 \f$ q_{min}/3(1+q_{min}) \f$
+    float64              HillArgMax;         ///< 希尔球立方根表的上限 \f$ q_{max}/3(1+q_{max}) \f$
+    float64              LobeMaxError = 0;   ///< 瓣半径表的相对误差上界
+    float64              CbrtMaxError = 0;   ///< 立方根表的相对误差上界（两个立方根表的节点密度相同）
+    float64              FluidMaxError = 0;  ///< 流体洛希极限的相对误差上界，包含直接调用 cbrt 的扁率因子
+
+    /**
+     * @brief 查表计算密度比的立方根，用于洛希极限
+     */
+    float64 __Density_Cbrt(float64 X)const;
+
+    /**
+     * @brief 查表计算 \f$ \sqrt[3]{q/3(1+q)} \f$，用于希尔球
+     * @details 自变量范围由质量比范围决定，默认约为3.3e-5到1/3，与密度比的范围无关，因此单独制表。
+     */
+    float64 __Hill_Cbrt(float64 X)const;
+
+public:
+    /**
+     * @brief 构造函数，完成制表
+     * @param Range 制表范围和精度
+     * @throws std::logic_error 范围无效或容差小于双精度可达到的精度时抛出
+     */
+    explicit TabulatedRocheFunctions(const RangeType& Range = RangeType());
+
+    /**
+     * @brief 获取制表的相对误差上界
+     * @return float64 所有查表接口中最大的相对误差上界，由插值余项推导得到，包含 FluidRocheLimit 中直接调用 cbrt 的部分
+     */
+    float64 MaxRelativeError()const;
+
+    /**
+     * @brief 查表计算Eggleton (1983) 有效瓣半径
+     * @param MassRatio 质量比 \f$ q = M_2/M_1 \f$
+     * @return float64 伴星有效瓣半径（以间距为单位）
+     * 
+     * @see RocheLobe::CompanionEffectiveLobeRadius
+     */
+    float64 EggletonLobeRadius(float64 MassRatio)const;
+
+    /**
+     * @brief 查表计算刚体洛希极限
+     * @see RigidRocheLimit(float64, float64, float64)
+     */
+    float64 RigidRocheLimit(float64 PrimaryRadius, float64 PrimaryDensity, float64 CompanionDensity)const;
+
+    /**
+     * @brief 查表计算流体洛希极限
+     * @details 密度比的立方根查表，扁率因子的立方根调用 cbrt。
+     * @see FluidRocheLimit(float64, float64, float64, float64, float64)
+     */
+    float64 FluidRocheLimit(float64 PrimaryMass, float64 PrimaryRadius, float64 PrimaryFlattening, 
+                            float64 CompanionMass, float64 CompanionDensity)const;
+
+    /**
+     * @brief 查表近似计算希尔球半径
+     * @see ApproxHillSphere(float64, float64, float64)
+     */
+    float64 ApproxHillSphere(float64 PrimaryMass, float64 CompanionMass, float64 Separation)const;
+
+    /**
+     * @brief 批量查表计算有效瓣半径
+     * @param MassRatios 质量比数组
+     * @param Out 输出数组，可以与输入相同
+     * @param Count 数组长度
+     */
+    void EggletonLobeRadius(const float64* MassRatios, float64* Out, uint64 Count)const;
+
+    /**
+     * @brief 批量查表计算刚体洛希极限
+     * @param PrimaryRadius 主星半径数组
+     * @param PrimaryDensity 主星密度数组
+     * @param CompanionDensity 伴星密度数组
+     * @param Out 输出数组
+     * @param Count 数组长度
+     */
+    void RigidRocheLimit(const float64* PrimaryRadius, const float64* PrimaryDensity,
+        const float64* CompanionDensity, float64* Out, uint64 Count)const;
+
+    /**
+     * @brief 批量查表计算流体洛希极限
+     * @param PrimaryMass 主星质量数组
+     * @param PrimaryRadius 主星半径数组
+     * @param PrimaryFlattening 主星扁率数组
+     * @param CompanionMass 伴星质量数组
+     * @param CompanionDensity 伴星密度数组
+     * @param Out 输出数组
+     * @param Count 数组长度
+     */
+    void FluidRocheLimit(const float64* PrimaryMass, const float64* PrimaryRadius,
+        const float64* PrimaryFlattening, const float64* CompanionMass,
+        const float64* CompanionDensity, float64* Out, uint64 Count)const;
+
+    /**
+     * @brief 批量查表近似计算希尔球半径
+     * @param PrimaryMass 主星质量数组
+     * @param CompanionMass 伴星质量数组
+     * @param Separation 两星体间距数组
+     * @param Out 输出数组
+     * @param Count 数组长度
+     */
+    void ApproxHillSphere(const float64* PrimaryMass, const float64* CompanionMass,
+        const float64* Separation, float64* Out, uint64 Count)const;
+};
+
 /**
  * @brief 为伴星对象创建围绕主星的轨道。
  *
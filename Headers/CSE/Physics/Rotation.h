@@ -208,6 +208,25 @@ public:
      * @return 当前自转相位 (Angle类型)
      */
     virtual Angle RotationPhase() const = 0;
+
+    /**
+     * @brief 获取物体在当前时刻的姿态四元数
+     * @return 从赤道坐标系到物体固连坐标系的旋转，按(x, y, z, w)存放，w为实部
+     * @details 按IAU的约定，旋转由三次基本旋转组成：
+     * \f[
+     * \mathbf{R} = \mathbf{R}_z(W)\,\mathbf{R}_x(90^\circ - \delta_0)\,\mathbf{R}_z(90^\circ + \alpha_0)
+     * \f]
+     * 其中 \f$ \alpha_0, \delta_0 \f$ 为北极赤经赤纬，W为自转相位。默认实现由 NorthPolePos 和 RotationPhase 计算，
+     * 派生类可以重写此函数以缓存结果。
+     */
+    virtual vec4 Orientation() const;
+
+    /**
+     * @brief 获取物体在当前时刻的姿态矩阵
+     * @return 从赤道坐标系到物体固连坐标系的旋转矩阵
+     * @see Orientation
+     */
+    mat3 OrientationMatrix() const;
 };
 
 /**
@@ -236,6 +255,8 @@ protected:
     BaseType InitialState;
     /// @brief 当前计算出的状态参数
     BaseType CurrentState;
+    /// @brief 当前日期的姿态四元数，每次改变日期时立即重新计算
+    vec4 CurrentOrientation;
 
     /**
      * @brief 检查并验证输入的初始化参数
@@ -244,6 +265,13 @@ protected:
      */
     BaseType CheckParams(const BaseType& InitElems);
 
+    /**
+     * @brief 由当前日期重新计算 CurrentOrientation
+     * @details 所有改变日期的函数在更新 CurrentState 后调用此函数。这样 Orientation() 只读取成员而不写入，
+     *          多个线程可以同时对同一个跟踪器调用 const 成员函数。
+     */
+    void __Update_Orientation();
+
 public:
     /**
      * @brief 构造函数
@@ -266,6 +294,344 @@ public:
 
     void NorthPolePos(Sexagesimal* RA, Sexagesimal* Dec) const override;
     Angle RotationPhase() const override;
+
+    /**
+     * @brief 获取当前姿态四元数
+     * @details 返回改变日期时预先计算的结果。计算时周期项、北极赤经赤纬和自转相位的正弦余弦都用 sincos(Angle, float64*, float64*) 成对计算。
+     */
+    vec4 Orientation() const override;
+};
+
+/**
+ * @brief 基于经典自转模型的自转跟踪器实现类
+ * @details 实现了RotationTracker接口，使用 SimpleRotationalElems 描述的经典自转模型。北极方向由黄赤交角和升交点确定，
+ *          自转相位以恒星自转周期(StellarRotationPeriod)对应的角速度匀速增加。
+ *          Precession 有效（非0且非NaN）时，升交点以 \f$ 360^\circ\Delta t/P_{\text{prec}} \f$ 的速率匀速推进，北极随之绕黄极转动；
+ *          否则北极方向在整个跟踪过程中不变。
+ *
+ * 时间以自参考历元以来的整数计数（CSEEpoch::TicksPerSecond，即微秒）记录，推进时间时计数精确累加，当前儒略日由计数导出，
+ * 不会像直接累加儒略日那样在 \f$ JD \approx 2.45\times10^6 \f$ 附近每次损失约40微秒。
+ *
+ * 推进时间时只在当前相位和升交点上累加角速度与时间的乘积，不从参考历元重新计算，因此 AddSeconds 等函数的开销是常数。
+ * 为了避免累加的角度无限增大而损失精度，超出[0, 360)时立即折回；同时记录累加的次数，
+ * 每累加 RenormalizeInterval 次就由精确的时间计数从参考历元直接重新计算一次，以消除累加产生的舍入误差。SetDate 总是直接计算。
+ *
+ * 每次改变日期后立即计算姿态四元数并保存，Orientation() 和 OrientationMatrix() 不再经过 Sexagesimal 和三角函数。
+ */
+class SimpleRotationTracker : public RotationTracker
+{
+public:
+    using Mybase = RotationTracker; ///< 父类别名
+    using BaseType = SimpleRotationalElems; ///< 使用的参数类型别名
+
+    /// @brief 累加多少次后从参考历元重新计算相位
+    static constexpr uint64 RenormalizeInterval = 4096;
+
+protected:
+    /// @brief 初始状态参数
+    BaseType InitialState;
+    /// @brief 参考历元，由 InitialState.RotationEpoch 转换得到
+    CSEEpoch ReferenceEpoch;
+    /// @brief 自参考历元以来经过的时间 (CSEEpoch 的计数，即微秒)
+    int64    ElapsedTicks = 0;
+    /// @brief 当前自转相位 (角度，范围[0, 360))
+    float64  CurrentPhase;
+    /// @brief 当前升交点赤经 (角度，范围[0, 360))
+    float64  CurrentNode;
+    /// @brief 自转角速度 (度/秒)
+    float64  AngularVelocity;
+    /// @brief 升交点的进动角速度 (度/秒)，Precession无效时为0
+    float64  NodeRate = 0;
+    /// @brief 自上次重新计算以来的累加次数
+    uint64   StepsSinceRenormalize = 0;
+    /// @brief 当前日期的姿态四元数，每次改变日期时立即重新计算
+    vec4     CurrentOrientation;
+
+    /**
+     * @brief 检查并验证输入的初始化参数
+     * @param[in] InitElems 待检查的初始参数
+     * @return 验证后可能被调整的参数
+     */
+    BaseType CheckParams(const BaseType& InitElems);
+
+    /**
+     * @brief 按时间计数累加相位和升交点
+     * @param[in] Ticks 时间计数，可以为负数
+     */
+    void __Accumulate(int64 Ticks);
+
+    /**
+     * @brief 由 ElapsedTicks 直接计算相位和升交点
+     */
+    void __Renormalize();
+
+    /**
+     * @brief 由当前相位和升交点重新计算 CurrentOrientation
+     */
+    void __Update_Orientation();
+
+public:
+    /**
+     * @brief 构造函数
+     * @param[in] InitElems 初始化用的自转模型参数
+     */
+    explicit SimpleRotationTracker(const BaseType& InitElems);
+
+    // --- RotationTracker 接口实现 ---
+    void AddMsecs(int64 Ms) override;
+    void AddSeconds(int64 Sec) override;
+    void AddHours(int64 Hrs) override;
+    void AddDays(int64 Days) override;
+    void AddYears(int64 Years) override;
+    void AddCenturies(int64 Centuries) override;
+
+    void ToCurrentDate() override;
+    void SetDate(CSEDateTime DateTime) override;
+    void SetDate(float64 JD) override;
+    void Reset() override;
+
+    void NorthPolePos(Sexagesimal* RA, Sexagesimal* Dec) const override;
+    Angle RotationPhase() const override;
+
+    /**
+     * @brief 获取当前姿态四元数
+     * @details 返回改变日期时预先计算的结果，OrientationMatrix() 由此得到。
+     */
+    vec4 Orientation() const override;
+};
+
+/**
+ * @brief 经典自转模型的批量跟踪器
+ * @details 以按字段分开的数组同时跟踪大量物体，所有物体共用同一个当前日期。推进时间时对所有物体的相位和升交点做一次向量化的乘加，
+ *          时间计数、升交点进动、折回和重新计算的策略与 SimpleRotationTracker 相同。
+ */
+class SimpleRotationBatch
+{
+public:
+    using BaseType = SimpleRotationalElems; ///< 使用的参数类型别名
+
+protected:
+    CSEEpoch              CurrentEpoch;     ///< 当前日期，以整数计数推进
+    std::vector<BaseType> InitialStates;    ///< 各物体的初始参数
+    std::vector<CSEEpoch> ReferenceEpochs;  ///< 各物体的参考历元
+    std::vector<float64>  Phases;           ///< 各物体的当前自转相位 (角度)
+    std::vector<float64>  Nodes;            ///< 各物体的当前升交点赤经 (角度)
+    std::vector<float64>  AngularVelocities;///< 各物体的自转角速度 (度/秒)
+    std::vector<float64>  NodeRates;        ///< 各物体升交点的进动角速度 (度/秒)，Precession无效时为0
+    uint64                StepsSinceRenormalize = 0; ///< 自上次重新计算以来的累加次数
+
+public:
+    /**
+     * @brief 构造函数
+     * @param[in] Elems 各物体的自转模型参数
+     * @param[in] JD 初始日期 (儒略日)
+     */
+    SimpleRotationBatch(const std::vector<BaseType>& Elems, float64 JD);
+
+    /**
+     * @brief 获取物体数量
+     */
+    uint64 Size()const;
+
+    /**
+     * @brief 推进指定的秒数
+     * @param[in] Sec 秒数，可以为负数，按 CSEEpoch 的计数（微秒）取整后累加到当前日期
+     */
+    void AddSeconds(float64 Sec);
+
+    /**
+     * @brief 设置内部日期为指定的儒略日，直接计算所有物体的相位和升交点
+     * @param[in] JD 目标儒略日
+     * @param[in] Threads 工作线程数，为0时自动选择
+     */
+    void SetDate(float64 JD, uint64 Threads = 0);
+
+    /**
+     * @brief 获取所有物体的当前自转相位
+     * @return 自转相位数组 (角度)
+     */
+    std::span<const float64> RotationPhases()const;
+
+    /**
+     * @brief 获取所有物体的当前升交点赤经
+     * @return 升交点赤经数组 (角度)
+     */
+    std::span<const float64> AscendingNodes()const;
+};
+
+/**
+ * @brief IAU自转模型的批量求值器
+ * @details 用于同一物体在大量历元上的求值，或大量物体在同一历元上的求值，输出北极赤经、赤纬和自转相位数组，
+ *          不经过 IAU_WGCCRERotationTracker 的状态推进和Sexagesimal转换。
+ *
+ * 构造时把 WGCCREComplexRotationalElems::PeriodicTerms 展开为按字段分开的连续数组（振幅、相位、频率、频率变化率各一个），
+ * 求值时对所有周期项的辐角一次性调用 sincos(std::span<const float64>, std::span<float64>, std::span<float64>, uint64)，再分别与三组振幅做点积。
+ *
+ * 批量 sincos 的输入单位与标量三角函数相同，默认为度，启用编译选项 TrigonoUseRadians 时为弧度。相位、频率和频率变化率数组
+ * 在构造时从 Angle 按此单位取值（默认即 Angle::Data 本身，与标量的 WGCCREComplexRotationalElems 一致），求值时不再换算。
+ *
+ * 对于等间隔的历元序列，辐角 \f$ \theta_k = \delta t_k^2 + \omega t_k + \varphi \f$ 的增量本身也是等差的，
+ * 因此每个周期项的正弦和余弦可以用两级旋转递推得到：
+ * \f[
+ * \begin{aligned}
+ * \sin\theta_{k+1} &= \sin\theta_k\cos\Delta_k + \cos\theta_k\sin\Delta_k \\
+ * \cos\theta_{k+1} &= \cos\theta_k\cos\Delta_k - \sin\theta_k\sin\Delta_k
+ * \end{aligned}
+ * \f]
+ * 其中 \f$ \Delta_k \f$ 同样按 \f$ \Delta_{k+1} = \Delta_k + 2\delta h^2 \f$ 递推。每一步只需要乘加运算，
+ * 为了限制舍入误差的累积，每隔 RecurrenceResetInterval 步用直接求值重新校准一次。
+ */
+class IAU_WGCCREBatchEvaluator
+{
+public:
+    using BaseType = WGCCREComplexRotationalElems; ///< 使用的参数类型别名
+
+    /// @brief 递推求值时重新校准的间隔步数
+    static constexpr uint64 RecurrenceResetInterval = 256;
+
+protected:
+    BaseType             Elems;          ///< 自转模型参数
+    std::vector<float64> PoleRAAmp;      ///< 赤经扰动振幅数组
+    std::vector<float64> PoleDecAmp;     ///< 赤纬扰动振幅数组
+    std::vector<float64> PrimeMerAmp;    ///< 本初子午线扰动振幅数组
+    std::vector<float64> TermPhase;      ///< 初始相位数组 (单位与标量三角函数相同，默认为度)
+    std::vector<float64> TermFrequency;  ///< 频率数组 (单位与标量三角函数相同，默认为度/单位时间)
+    std::vector<float64> TermFreqRate;   ///< 频率变化率数组 (单位与标量三角函数相同，默认为度/单位时间^2)
+
+    /**
+     * @brief 由各周期项的正弦和余弦值合成结果
+     * @param[in] JD 历元 (儒略日)
+     * @param[in] Sin 各周期项辐角的正弦值
+     * @param[in] Cos 各周期项辐角的余弦值
+     * @param[out] PoleRA 北极赤经 (角度)
+     * @param[out] PoleDec 北极赤纬 (角度)
+     * @param[out] Phase 自转相位 (角度)
+     */
+    void __Combine(float64 JD, const float64* Sin, const float64* Cos,
+        float64* PoleRA, float64* PoleDec, float64* Phase)const;
+
+public:
+    /**
+     * @brief 构造函数
+     * @param[in] InitElems 自转模型参数
+     */
+    explicit IAU_WGCCREBatchEvaluator(const BaseType& InitElems);
+
+    /**
+     * @brief 在任意历元上求值
+     * @param[in] JD 历元数组 (儒略日)
+     * @param[out] PoleRA 北极赤经数组 (角度)，可以为空指针
+     * @param[out] PoleDec 北极赤纬数组 (角度)，可以为空指针
+     * @param[out] Phase 自转相位数组 (角度)，可以为空指针
+     * @param[in] Count 数组长度
+     */
+    void Evaluate(const float64* JD, float64* PoleRA, float64* PoleDec,
+        float64* Phase, uint64 Count)const;
+
+    /**
+     * @brief 在等间隔的历元序列上求值
+     * @param[in] StartJD 起始历元 (儒略日)
+     * @param[in] StepDays 历元间隔 (天)
+     * @param[out] PoleRA 北极赤经数组 (角度)，可以为空指针
+     * @param[out] PoleDec 北极赤纬数组 (角度)，可以为空指针
+     * @param[out] Phase 自转相位数组 (角度)，可以为空指针
+     * @param[in] Count 历元数量
+     * @details 使用三角递推代替逐点的sincos。
+     */
+    void EvaluateUniform(float64 StartJD, float64 StepDays, float64* PoleRA,
+        float64* PoleDec, float64* Phase, uint64 Count)const;
+
+    /**
+     * @brief 在同一历元上对多个物体求值
+     * @param[in] Bodies 各物体的求值器
+     * @param[in] JD 历元 (儒略日)
+     * @param[out] PoleRA 北极赤经数组 (角度)，长度为物体数量，可以为空指针
+     * @param[out] PoleDec 北极赤纬数组 (角度)，长度为物体数量，可以为空指针
+     * @param[out] Phase 自转相位数组 (角度)，长度为物体数量，可以为空指针
+     * @param[in] Threads 工作线程数，为0时自动选择
+     */
+    static void Evaluate(const std::vector<IAU_WGCCREBatchEvaluator>& Bodies, float64 JD,
+        float64* PoleRA, float64* PoleDec, float64* Phase, uint64 Threads = 0);
+};
+
+/**
+ * @brief 由四元数计算旋转矩阵
+ * @param[in] Quat 单位四元数，按(x, y, z, w)存放
+ * @return 旋转矩阵
+ */
+mat3 QuaternionToMatrix(vec4 Quat);
+
+/**
+ * @brief 四元数球面线性插值 (SLERP)
+ * @param[in] Q0 起始四元数
+ * @param[in] Q1 结束四元数
+ * @param[in] t 插值参数，范围[0, 1]
+ * @return 插值后的单位四元数
+ * @details 两个四元数的夹角很小时退化为归一化线性插值，避免除以接近0的正弦值。点积为负时先将Q1取反，保证沿最短路径插值。
+ */
+vec4 Slerp(vec4 Q0, vec4 Q1, float64 t);
+
+/**
+ * @brief 物体姿态缓存
+ * @details 在一段时间内按等间隔对自转跟踪器采样姿态四元数并缓存，查询任意时刻的姿态时在相邻两个采样之间做球面线性插值，
+ *          逐帧渲染时不再需要调用跟踪器做三角函数计算。
+ *
+ * 采样间隔需要远小于自转周期：SLERP只能表示两个采样间绕固定轴的匀速转动，转角超过180°时会选错方向。
+ * 由于自转是绕近似固定的轴匀速转动，采样间隔取自转周期的1/8左右时插值误差已经很小。
+ */
+class OrientationCache
+{
+protected:
+    float64           StartJD;      ///< 第一个采样的历元 (儒略日)
+    float64           StepDays;     ///< 采样间隔 (天)
+    std::vector<vec4> Samples;      ///< 姿态四元数采样
+
+    /**
+     * @brief 对跟踪器采样
+     * @param[in] Tracker 调用方跟踪器的副本，采样过程中会改变其日期
+     * @param[in] Count 采样数量
+     * @throws std::logic_error 参数无效时抛出
+     */
+    void __Sample(RotationTracker& Tracker, uint64 Count);
+
+public:
+    /**
+     * @brief 构造函数，对跟踪器采样
+     * @tparam TrackerType 自转跟踪器的具体类型
+     * @param[in] Tracker 自转跟踪器，按值传入，采样在副本上进行，不会改变调用方的跟踪器
+     * @param[in] StartJD 起始历元 (儒略日)
+     * @param[in] StepDays 采样间隔 (天)
+     * @param[in] Count 采样数量，至少为2
+     * @throws std::logic_error 参数无效时抛出
+     */
+    template<typename TrackerType> requires std::is_base_of_v<RotationTracker, TrackerType>
+    OrientationCache(TrackerType Tracker, float64 StartJD, float64 StepDays, uint64 Count)
+        : StartJD(StartJD), StepDays(StepDays)
+    {
+        __Sample(Tracker, Count);
+    }
+
+    /**
+     * @brief 获取指定时刻的姿态四元数
+     * @param[in] JD 历元 (儒略日)，超出采样范围时取端点值
+     */
+    vec4 Orientation(float64 JD)const;
+
+    /**
+     * @brief 获取指定时刻的姿态矩阵
+     * @param[in] JD 历元 (儒略日)，超出采样范围时取端点值
+     */
+    mat3 OrientationMatrix(float64 JD)const;
+
+    /**
+     * @brief 批量获取多个物体在同一时刻的姿态矩阵
+     * @param[in] Caches 各物体的姿态缓存
+     * @param[in] JD 历元 (儒略日)
+     * @param[out] Out 输出的姿态矩阵数组，长度为物体数量
+     * @param[in] Threads 工作线程数，为0时自动选择
+     */
+    static void FillMatrices(const std::vector<OrientationCache>& Caches, float64 JD,
+        mat3* Out, uint64 Threads = 0);
 };
 
 /**